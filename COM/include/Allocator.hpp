@@ -0,0 +1,88 @@
+//
+//  Copyright@2013, Illinois Rocstar LLC. All rights reserved.
+//
+//  See LICENSE file included with this source or
+//  (opensource.org/licenses/NCSA) for license information.
+//
+
+/** \file Allocator.hpp
+ * Contains the allocators for the arrays of dataitems allocated by COM.
+ * @see Allocator.C
+ */
+
+#ifndef __COM_ALLOCATOR_H__
+#define __COM_ALLOCATOR_H__
+
+#include <cstddef>
+#include "com_basic.h"
+
+COM_BEGIN_NAME_SPACE
+
+/** An Allocator provides the memory for the arrays that COM allocates for
+ *  the dataitems of a window (see ComponentInterface::set_allocator).
+ *  The default implementation returns aligned memory, optionally backed
+ *  by huge pages, and initializes it according to its options. Derived
+ *  classes may override allocate() and deallocate() to plug in other
+ *  memory sources. An allocator must outlive the arrays it allocated.
+ */
+class Allocator {
+ public:
+  /// Use of huge pages.
+  enum Huge_pages {
+    HUGE_PAGES_NONE,         ///< Regular pages.
+    HUGE_PAGES_TRANSPARENT,  ///< Advise the kernel to use transparent
+                             ///< huge pages for large arrays.
+    HUGE_PAGES_EXPLICIT      ///< Map large arrays from the huge page pool,
+                             ///< falling back to regular pages.
+  };
+
+  struct Options {
+    Options()
+        : alignment(64),
+          huge_pages(HUGE_PAGES_NONE),
+          first_touch_parallel(false),
+          zero_fill(true) {}
+
+    std::size_t alignment;  ///< Alignment in bytes (a power of 2).
+    int huge_pages;         ///< One of Huge_pages.
+    /// Initialize the arrays with all threads, each writing a contiguous
+    /// chunk, so that the pages are placed on the NUMA nodes of the
+    /// threads that later work on the same chunks.
+    bool first_touch_parallel;
+    /// Fill the arrays with 0s. If false, the contents of new arrays are
+    /// undefined, unless first_touch_parallel is true.
+    bool zero_fill;
+  };
+
+ public:
+  explicit Allocator(const Options &opts = Options());
+  virtual ~Allocator() {}
+
+  /// Allocate an array of nbytes bytes. Throws std::bad_alloc on failure.
+  virtual void *allocate(std::size_t nbytes);
+
+  /// Deallocate an array of nbytes bytes obtained from allocate().
+  virtual void deallocate(void *p, std::size_t nbytes);
+
+  const Options &options() const { return _opts; }
+
+  /// Obtain the allocator used by windows without their own allocator.
+  static Allocator *get_default();
+
+  /// Change the default allocator. If a is NULL, restore the built-in one.
+  static void set_default(Allocator *a);
+
+ protected:
+  /// Whether an array of nbytes is mapped from the huge page pool.
+  bool use_mmap(std::size_t nbytes) const;
+
+  /// Initialize a newly allocated array according to the options.
+  void initialize(void *p, std::size_t nbytes) const;
+
+ protected:
+  Options _opts;
+};
+
+COM_END_NAME_SPACE
+
+#endif
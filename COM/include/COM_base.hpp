@@ -88,6 +88,21 @@ class COM_base {
   /// Deletes a pane and its associated data.
   void delete_pane(const std::string &wname, const int pid);
 
+  /** Moves the panes pane_ids[i] (0<=i<n) of a window to the processes
+   *  ranks[i] of its communicator, with all their dataitems. It must be
+   *  called by all the processes of the window with the same arguments.
+   */
+  void migrate_panes(const std::string &wname, int n, const int *pane_ids,
+                     const int *ranks);
+
+  /** Migrates panes of a window to balance the sums of the costs of the
+   *  panes on its processes within a factor of 1+tol of their mean.
+   *  The costs are given by a double-precision pane dataitem
+   *  ("window.dataitem"), e.g. measured timings. Collective over the
+   *  window. Returns the number of migrated panes.
+   */
+  int rebalance_panes(const std::string &waname, double tol);
+
   //\}
 
   /** \name DataItem management
@@ -102,7 +117,8 @@ class COM_base {
 
   /// Set the sizes of an dataitem. Note that for nodal or elemental data,
   /// setting sizes for one such dataitems affects all other dataitems.
-  void set_size(const std::string &wa_str, int pane_id, int nitems, int ng = 0);
+  void set_size(const std::string &wa_str, int pane_id, COM_Size nitems,
+                COM_Size ng = 0);
 
   /// Associates an object with a specific window.
   void set_object(const std::string &wa, const int pane_id, void *obj_addr,
@@ -113,7 +129,7 @@ class COM_base {
 
   /// Associates an array with an dataitem for a specific pane.
   void set_array(const std::string &wa, const int pane_id, void *addr,
-                 int strd = 0, int cap = 0, bool is_const = false);
+                 int strd = 0, COM_Size cap = 0, bool is_const = false);
 
   template <class T>
   void set_bounds(const std::string &wa, const int pane_id, T lbnd, T ubnd) {
@@ -138,7 +154,7 @@ class COM_base {
   /// address by setting addr. Allocate for all panes if pane-id is 0,
   /// in which case, do not set addr.
   void allocate_array(const std::string &wa, const int pane_id = 0,
-                      void **addr = NULL, int strd = 0, int cap = 0);
+                      void **addr = NULL, int strd = 0, COM_Size cap = 0);
 
   /// Resize an dataitem on a specific pane and return the
   /// address by setting addr. Resize for all panes if pane-id is 0,
@@ -146,12 +162,12 @@ class COM_base {
   /// allocate is that resize will reallocate memory only if the current
   /// array cannot accomodate the requested capacity.
   void resize_array(const std::string &wa, const int pane_id = 0,
-                    void **addr = NULL, int strd = -1, int cap = 0);
+                    void **addr = NULL, int strd = -1, COM_Size cap = 0);
 
   /// Append an array to the end of the dataitem on a specific pane and
   /// return the new address by setting addr.
   void append_array(const std::string &wa, const int pane_id, const void *val,
-                    int v_strd, int v_size);
+                    int v_strd, COM_Size v_size);
 
   /// Use the subset of panes of another window
   /// of which the given pane dataitem has value val.
@@ -173,6 +189,9 @@ class COM_base {
   void copy_dataitem(int trg_hdl, int src_hdl, int withghost = 1,
                      int ptn_hdl = 0, int val = 0);
 
+  /// Exchange the arrays of two dataitems on all panes without copying.
+  void swap_arrays(int hdl1, int hdl2);
+
   /// Deallocate space for an dataitem in a pane, asuming the memory was
   /// allocated allocate_mesh or allocate_dataitem.
   void deallocate_array(const std::string &wa, const int pid = 0);
@@ -183,6 +202,11 @@ class COM_base {
                     std::string *unit);
 
   /// Get the sizes of an dataitem. The opposite of set_size.
+  void get_size(const std::string &wa_str, int pane_id, COM_Size *size,
+                COM_Size *ng = 0);
+
+  /// Get the sizes of an dataitem as ints, for the C and Fortran interfaces.
+  /// It is an error if the sizes do not fit.
   void get_size(const std::string &wa_str, int pane_id, int *size, int *ng = 0);
 
   /** Get the status of an dataitem. If the dataitem name is empty, and pane
@@ -202,16 +226,27 @@ class COM_base {
 
   /// Get the address for an dataitem on a specific pane.
   void get_array(const std::string &wa, const int pane_id, void **addr,
-                 int *strd = NULL, int *cap = 0, bool is_const = false);
+                 int *strd, COM_Size *cap, bool is_const = false);
 
   /// Get the address for an dataitem on a specific pane.
+  void get_array(const std::string &wa, const int pane_id,
+                 Pointer_descriptor &addr, int *strd, COM_Size *cap,
+                 bool is_const = false);
+
+  /// Get the address for an dataitem on a specific pane, with the capacity
+  /// as an int for the C and Fortran interfaces.
+  void get_array(const std::string &wa, const int pane_id, void **addr,
+                 int *strd = NULL, int *cap = 0, bool is_const = false);
+
+  /// Get the address for an dataitem on a specific pane, with the capacity
+  /// as an int for the C and Fortran interfaces.
   void get_array(const std::string &wa, const int pane_id,
                  Pointer_descriptor &addr, int *strd = NULL, int *cap = 0,
                  bool is_const = false);
 
   /// Copy an array from an dataitem on a specific pane into a given buffer.
   void copy_array(const std::string &wa, const int pane_id, void *val,
-                  int v_strd = 0, int v_size = 0, int offset = 0);
+                  int v_strd = 0, COM_Size v_size = 0, COM_Size offset = 0);
 
   void set_f90pointer(const std::string &waname, void *ptr, Func_ptr f,
                       long int l);
@@ -220,6 +255,43 @@ class COM_base {
                       long int l);
   //\}
 
+  /** \name Memory management
+   * \{
+   */
+  /// Set the allocator for the arrays of the window allocated by COM.
+  /// If a is NULL, the window uses the default allocator.
+  void set_allocator(const std::string &wname, Allocator *a);
+
+  /** Obtain the numbers of bytes of the arrays of a window or dataitem
+   *  ("window" or "window.dataitem") on a pane that were allocated by COM,
+   *  set by the user, or inherited from another window. If pane_id is 0,
+   *  sum over all the local panes. NULL pointers are ignored.
+   */
+  void get_memory_usage(const std::string &waname, int pane_id,
+                        COM_Size *allocated, COM_Size *user = NULL,
+                        COM_Size *inherited = NULL);
+
+  /// Obtain the number of bytes currently allocated by COM for a window
+  /// and the peak since its creation or the last reset_memory_peak().
+  void get_memory_peak(const std::string &wname, COM_Size *current,
+                       COM_Size *peak);
+
+  /// Reset the peak memory of a window to its current allocation.
+  void reset_memory_peak(const std::string &wname);
+
+  /// Trace the allocations and deallocations by COM for a window to os.
+  /// If os is NULL, stop tracing.
+  void set_memory_trace(const std::string &wname, std::ostream *os);
+
+  /** Append a report of the memory usage of a window, summed over the
+   *  processes of its communicator, to the file fname (or stdout if
+   *  fname is empty). It must be called by all the processes of the
+   *  window, which must have the same dataitems.
+   */
+  void print_memory_usage(const std::string &wname, const std::string &fname,
+                          const std::string &header);
+  //\}
+
   /** \name Information retrieval
    * \{
    */
@@ -8,7 +8,11 @@
 #ifndef __COM_COMPONENT_INTERFACE_H__
 #define __COM_COMPONENT_INTERFACE_H__
 
+#include <atomic>
+#include <iosfwd>
 #include <map>
+#include <mutex>
+#include "Allocator.hpp"
 #include "Function.hpp"
 #include "Pane.hpp"
 
@@ -74,6 +78,53 @@ class ComponentInterface {
   MPI_Comm get_communicator() const { return _comm; }
   //\}
 
+  /** \name Memory management
+   * \{
+   */
+  /** Set the allocator for the arrays allocated for the dataitems of the
+   *  CI from now on. If a is NULL, use the default allocator. Arrays that
+   *  were already allocated are released by the allocator that allocated
+   *  them, which must therefore outlive them.
+   */
+  void set_allocator(Allocator *a) { _allocator = a; }
+
+  /// Obtain the allocator for the arrays of the dataitems of the CI.
+  Allocator *allocator() const {
+    return _allocator ? _allocator : Allocator::get_default();
+  }
+
+  /** Obtain the numbers of bytes of the arrays of a dataitem on a pane,
+   *  classified into allocated by COM, set by the user, and inherited
+   *  from another dataitem (see DataItem::get_memory_usage). The values
+   *  are added to allocated, user, and inherited. If aname is empty, sum
+   *  over all the dataitems and connectivity tables; "conn" sums over the
+   *  connectivity tables. If pane_id is 0, sum over all the local panes,
+   *  including the window dataitems.
+   */
+  void get_memory_usage(const std::string &aname, int pane_id,
+                        COM_Size &allocated, COM_Size &user,
+                        COM_Size &inherited) const;
+
+  /// Record a change of delta bytes of the arrays allocated by COM for
+  /// dataitem a of the CI.
+  void record_memory(const DataItem *a, COM_Size delta);
+
+  /// Obtain the number of bytes currently allocated by COM for the CI.
+  COM_Size memory_allocated() const { return _mem_allocated; }
+
+  /// Obtain the maximum number of bytes allocated by COM for the CI since
+  /// its creation or the last call to reset_memory_peak().
+  COM_Size memory_peak() const { return _mem_peak; }
+
+  /// Reset the peak to the number of bytes currently allocated.
+  void reset_memory_peak() { _mem_peak = _mem_allocated; }
+
+  /** Write a line to os for every array allocated or deallocated by COM
+   *  for the CI from now on. If os is NULL, stop tracing.
+   */
+  void set_memory_trace(std::ostream *os) { _mem_trace = os; }
+  //\}
+
   /** \name Function and data management
    * \{
    */
@@ -106,7 +157,8 @@ class ComponentInterface {
    *  \param nitems total number of items (including ghosts)
    *  \param ng     number of ghosts
    */
-  void set_size(const std::string &aname, int pane_id, int nitems, int ng = 0);
+  void set_size(const std::string &aname, int pane_id, COM_Size nitems,
+                COM_Size ng = 0);
 
   /** Associate an array with an dataitem for a specific pane.
    *  \param aname  dataitem name
@@ -117,27 +169,29 @@ class ComponentInterface {
    *  \seealso alloc_array, resize_array
    */
   void set_array(const std::string &aname, const int pane_id, void *addr,
-                 int strd = 0, int cap = 0, bool is_const = false);
+                 int strd = 0, COM_Size cap = 0, bool is_const = false);
 
   /** Allocate memory for an dataitem for a specific pane and
    *  set addr to the address.
    *  \seealso alloc_array, resize_array, append_array
    */
   void alloc_array(const std::string &aname, const int pane_id, void **addr,
-                   int strd = 0, int cap = 0);
+                   int strd = 0, COM_Size cap = 0);
 
   /** Resize memory for an dataitem for a specific pane and
    *  set addr to the address.
    *  \seealso set_array, alloc_array, append_array
    */
   void resize_array(const std::string &aname, const int pane_id, void **addr,
-                    int strd = -1, int cap = 0);
+                    int strd = -1, COM_Size cap = 0);
 
-  void resize_array(DataItem *a, void **addr, int strd = -1, int cap = 0) {
+  void resize_array(DataItem *a, void **addr, int strd = -1,
+                    COM_Size cap = 0) {
     reinit_dataitem(a, Pane::OP_RESIZE, addr, strd, cap);
   }
 
-  void resize_array(Connectivity *c, void **addr, int strd = -1, int cap = 0) {
+  void resize_array(Connectivity *c, void **addr, int strd = -1,
+                    COM_Size cap = 0) {
     reinit_conn(c, Pane::OP_RESIZE, (int **)addr, strd, cap);
   }
 
@@ -146,7 +200,7 @@ class ComponentInterface {
    *  \seealso set_array, alloc_array, resize_array
    */
   void append_array(const std::string &aname, const int pane_id,
-                    const void *val, int v_strd, int v_size);
+                    const void *val, int v_strd, COM_Size v_size);
 
   /** Deallocate memory for an dataitem for a specific pane if
    *  allocated by Roccom.
@@ -191,8 +245,8 @@ class ComponentInterface {
    *  \param nitems total number of items (including ghosts)
    *  \param ng     number of ghosts
    */
-  void get_size(const std::string &aname, int pane_id, int *nitems,
-                int *ng) const;
+  void get_size(const std::string &aname, int pane_id, COM_Size *nitems,
+                COM_Size *ng) const;
 
   /** Get the status of an dataitem or pane.
    *  \seealso Roccom_base::get_status()
@@ -214,8 +268,8 @@ class ComponentInterface {
    *  \seealso alloc_array, resize_array, copy_array
    */
   void get_array(const std::string &aname, const int pane_id,
-                 Pointer_descriptor &addr, int *strd = NULL, int *cap = NULL,
-                 bool is_const = false);
+                 Pointer_descriptor &addr, int *strd = NULL,
+                 COM_Size *cap = NULL, bool is_const = false);
 
   /** Copy an dataitem on a specific pane into a given array.
    *  \param aname   dataitem name
@@ -229,7 +283,8 @@ class ComponentInterface {
    *  \seealso alloc_array, resize_array, get_array
    */
   void copy_array(const std::string &aname, const int pane_id, void *val,
-                  int v_strd = 0, int v_size = 0, int offset = 0) const;
+                  int v_strd = 0, COM_Size v_size = 0,
+                  COM_Size offset = 0) const;
 
   /// Perform some final checking of the CI.
   void init_done(bool pane_changed = true);
@@ -265,8 +320,43 @@ class ComponentInterface {
       delete it->second;
       _pane_map.erase(it);
     }
+    invalidate_pane_cache();
   }
 
+  /** Serialize a local pane into buf: the sizes and the arrays of its
+   *  coordinates, connectivity tables, pconn and ridges, and of all its
+   *  pane, connectivity, nodal and elemental dataitems. Arrays of pointer
+   *  types are not meaningful on other processes and only their sizes
+   *  are recorded. Structured panes are not supported.
+   *  \seealso unpack_pane, migrate_panes
+   */
+  void pack_pane(const int pane_id, std::vector<char> &buf) const;
+
+  /** Create a pane from a buffer written by pack_pane and allocate and
+   *  fill in its arrays. The CI window must have the dataitems of the
+   *  packed pane and must not have a pane with the same ID.
+   *  Returns the ID of the pane. Call init_done afterwards.
+   */
+  int unpack_pane(const char *buf, std::size_t len);
+
+  /** Move the panes pane_ids[i] (0<=i<n) to the process ranks[i] of the
+   *  communicator of the CI window and update the process map. It must
+   *  be called by all the processes of the window with the same
+   *  arguments. Since the pconn refers to panes by ID, it remains valid.
+   *  If a pane cannot be packed or unpacked, e.g., it is structured, all
+   *  the processes throw and the panes stay where they were.
+   */
+  void migrate_panes(int n, const int *pane_ids, const int *ranks);
+
+  /** Migrate panes so that the sums of the costs of the panes on the
+   *  processes are within a factor of 1+tol of their mean. The cost of
+   *  each pane, typically its measured computing time, is given by the
+   *  double-precision pane dataitem aname. Panes are moved greedily from
+   *  the most to the least loaded process. Collective over the window.
+   *  Returns the number of panes that were migrated.
+   */
+  int rebalance_panes(const std::string &aname, double tol);
+
   //\}
 
   /** \name Miscellaneous
@@ -281,6 +371,20 @@ class ComponentInterface {
 
   /// Obtain all the local panes of the CI window.
   void panes(std::vector<Pane *> &ps);
+
+  /** Obtain all the local panes of the CI window in increasing order of
+   *  their IDs. The array is built by init_done and cached until the panes
+   *  or dataitems of the CI change, so it is cheap to call repeatedly and
+   *  concurrent calls on an initialized CI only read it.
+   */
+  const std::vector<Pane *> &panes() const;
+
+  /** Obtain the objects of the dataitem with index i on all the local
+   *  panes, in the order of panes(). The array is cached like panes().
+   *  Since the panes of all windows are ordered by their IDs, the arrays
+   *  of dataitems of windows with the same panes are aligned.
+   */
+  const std::vector<DataItem *> &pane_dataitems(int i) const;
   /// Obtain all the local panes of the CI window.
   void panes(std::vector<const Pane *> &ps) const {
     const_cast<ComponentInterface *>(this)->panes((std::vector<Pane *> &)ps);
@@ -321,7 +425,7 @@ class ComponentInterface {
    *  \param cap    capacity
    */
   void reinit_dataitem(DataItem *attr, OP_Init op, void **addr = NULL,
-                       int strd = 0, int cap = 0);
+                       int strd = 0, COM_Size cap = 0);
 
   /** Template implementation for setting (op==OP_SET or OP_SET_CONST),
    *   allocating (op==OP_ALLOC), resizing (op==OP_RESIZE) and deallocating
@@ -333,7 +437,18 @@ class ComponentInterface {
    *  \param cap    capacity
    */
   void reinit_conn(Connectivity *con, OP_Init op, int **addr = NULL,
-                   int strd = 0, int cap = 0);
+                   int strd = 0, COM_Size cap = 0);
+
+  /// Discard the cached arrays of panes and of pane dataitems.
+  void invalidate_pane_cache() {
+    _pane_vec.clear();
+    _pane_items.clear();
+    _pane_cache_valid = false;
+  }
+
+  /// Build the cached arrays of panes and of all pane dataitems, unless
+  /// they are up to date.
+  void build_pane_cache() const;
 
  protected:
   Pane _dummy;         ///< Dummy pane.
@@ -344,9 +459,24 @@ class ComponentInterface {
   Pane_map _pane_map;  ///< Map from pane ID to their metadata.
   Proc_map _proc_map;  ///< Map from pane ID to process ranks
 
+  /// The caches are built by init_done, so they are only read afterwards.
+  /// If the CI has changed since, the first call rebuilds them under
+  /// _pane_cache_mutex.
+  mutable std::vector<Pane *> _pane_vec;  ///< Cached array of local panes.
+  /// Cached arrays of the dataitems on the local panes, indexed by their
+  /// indices.
+  mutable std::vector<std::vector<DataItem *>> _pane_items;
+  /// Whether _pane_vec and _pane_items are up to date.
+  mutable std::atomic<bool> _pane_cache_valid;
+  mutable std::mutex _pane_cache_mutex;  ///< Guards building the caches.
+
   int _last_id;    ///< The last used dataitem index. The next
                    ///< available one is _last_id+1.
   MPI_Comm _comm;  ///< the MPI communicator of the CI.
+  Allocator *_allocator;    ///< Allocator for the arrays of the dataitems.
+  COM_Size _mem_allocated;  ///< Number of bytes allocated by COM.
+  COM_Size _mem_peak;       ///< Peak of _mem_allocated since last reset.
+  std::ostream *_mem_trace;  ///< Stream for tracing allocations, or NULL.
   enum { STATUS_SHRUNK, STATUS_CHANGED, STATUS_NOCHANGE };
   int _status;  ///< Status of the CI.
 
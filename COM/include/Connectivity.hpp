@@ -57,6 +57,7 @@ class Connectivity : protected DataItem {
   using DataItem::deallocate;
   using DataItem::empty;
   using DataItem::fullname;
+  using DataItem::get_memory_usage;
   using DataItem::id;
   using DataItem::initialized;
   using DataItem::is_staggered;
@@ -161,22 +162,22 @@ class Connectivity : protected DataItem {
   static Size size_of_faces_pe(int type) { return _sizes[type][SIZE_NFACES]; }
 
   /// Get the total number of elements (including ghost elements) in the table.
-  Size size_of_elements() const;
+  COM_Size size_of_elements() const;
 
   /// Get the number of ghost elements.
-  Size size_of_ghost_elements() const;
+  COM_Size size_of_ghost_elements() const;
 
   /// Get the number of real elements.
-  Size size_of_real_elements() const;
+  COM_Size size_of_real_elements() const;
 
   /// Get the total number of nodes (including ghost nodes) of the owner pane.
-  Size size_of_nodes() const;
+  COM_Size size_of_nodes() const;
 
   /// Get the number of ghost nodes of the owner pane.
-  Size size_of_ghost_nodes() const;
+  COM_Size size_of_ghost_nodes() const;
 
   /// Get the number of real nodes of the owner pane.
-  Size size_of_real_nodes() const;
+  COM_Size size_of_real_nodes() const;
 
   /// Get the index of the first element.
   Size index_offset() const { return root()->_offset; }
@@ -201,9 +202,9 @@ class Connectivity : protected DataItem {
   /// Obtain the address of the jth component of the ith item, where
   /// 0<=i<size_of_items. This function is recursive and relatively expensive,
   /// and hence should be used only for performance-insenstive tasks.
-  const int *get_addr(int i, int j = 0) const;
+  const int *get_addr(COM_Size i, int j = 0) const;
 
-  int *get_addr(int i, int j = 0) {
+  int *get_addr(COM_Size i, int j = 0) {
     if (is_const()) throw COM_exception(COM_ERR_DATAITEM_CONST);
     return (int *)(((const Connectivity *)this)->get_addr(i, j));
   }
@@ -223,7 +224,7 @@ class Connectivity : protected DataItem {
   static const int *get_size_info(const std::string &aname);
 
   /// Allocate memory for unstructured mesh
-  void *allocate(int strd, int cap, bool force) {
+  void *allocate(int strd, COM_Size cap, bool force) {
     if (!is_structured())
       return DataItem::allocate(strd, cap, force);
     else
@@ -232,12 +233,12 @@ class Connectivity : protected DataItem {
 
   /// Set the size of items and ghost items. Can be changed only if the
   /// dataitem is a root.
-  void set_size(int nitems, int ngitems = 0);
+  void set_size(COM_Size nitems, COM_Size ngitems = 0);
   //\}
 
  protected:
   /// Set pointer of connectivity table
-  void set_pointer(void *p, int strd, int cap, bool is_const);
+  void set_pointer(void *p, int strd, COM_Size cap, bool is_const);
 
   /// Set the index of the first element.
   void set_offset(Size offset);
@@ -8,7 +8,9 @@
 #ifndef __COM_DATAITEM_H__
 #define __COM_DATAITEM_H__
 
+#include <algorithm>
 #include <string>
+#include "Allocator.hpp"
 #include "com_exception.hpp"
 
 COM_BEGIN_NAME_SPACE
@@ -61,7 +63,8 @@ class DataItem {
         _ptr(NULL),
         _strd(0),
         _nbytes_strd(0),
-        _cap(0) {}
+        _cap(0),
+        _alloc(NULL) {}
 
  protected:
   /// Constructor for keywords. The default nitems for keywords is 0.
@@ -81,7 +84,8 @@ class DataItem {
         _ptr(NULL),
         _strd(0),
         _nbytes_strd(0),
-        _cap(0) {}
+        _cap(0),
+        _alloc(NULL) {}
 
  public:
   /** Create an dataitem with name n in window w.
@@ -110,7 +114,8 @@ class DataItem {
         _ptr(0),
         _strd(0),
         _nbytes_strd(0),
-        _cap(0) {}
+        _cap(0),
+        _alloc(NULL) {}
 
   /** Inherit an dataitem from another.
    *  \param pane pointer to its owner pane object.
@@ -135,6 +140,7 @@ class DataItem {
     _strd = 0;
     _nbytes_strd = 0;
     _cap = 0;
+    _alloc = NULL;
   }
   //\}
 
@@ -189,9 +195,9 @@ class DataItem {
   /// Obtain the address of the jth component of the ith item, where
   /// 0<=i<size_of_items. This function is recursive and relatively expensive,
   /// and hence should be used only for performance-insenstive tasks.
-  const void *get_addr(int i, int j = 0) const;
+  const void *get_addr(COM_Size i, int j = 0) const;
 
-  void *get_addr(int i, int j = 0) {
+  void *get_addr(COM_Size i, int j = 0) {
     if (is_const()) throw COM_exception(COM_ERR_DATAITEM_CONST);
     return (void *)(((const DataItem *)this)->get_addr(i, j));
   }
@@ -235,31 +241,31 @@ class DataItem {
   int size_of_components() const { return _ncomp; }
 
   /// Obtain the number of items in the dataitem.
-  int size_of_items() const;
+  COM_Size size_of_items() const;
 
   /// Obtain the maximum allowed number of items in the dataitem.
   /// Reserved for Roccom3.1
-  int maxsize_of_items() const;
+  COM_Size maxsize_of_items() const;
 
   /// Obtain the number of ghost items in the dataitem.
-  int size_of_ghost_items() const;
+  COM_Size size_of_ghost_items() const;
 
   /// Obtain the maximum allowed number of items in the dataitem.
   /// Reserved for Roccom3.1
-  int maxsize_of_ghost_items() const;
+  COM_Size maxsize_of_ghost_items() const;
 
   /// Obtain the number of real items in the dataitem.
-  int size_of_real_items() const;
+  COM_Size size_of_real_items() const;
 
   /// Obtain the maximum allowed number of real items in the dataitem.
   /// Reserved for Roccom3.1
-  int maxsize_of_real_items() const;
+  COM_Size maxsize_of_real_items() const;
 
   /// Check whether the number of items of the dataitem is zero.
   bool empty() const { return root()->_nitems <= 0; }
 
   /// Obtain the capacity of the array.
-  int capacity() const { return _status ? _cap : root()->_cap; }
+  COM_Size capacity() const { return _status ? _cap : root()->_cap; }
 
   /// Obtain the stride of the dataitem in base datatype.
   int stride() const { return _status ? _strd : root()->_strd; }
@@ -289,6 +295,15 @@ class DataItem {
   /// Returns whether the array is set to be read-only.
   bool is_const() const { return root()->_status == STATUS_SET_CONST; }
 
+  /** Add the number of bytes of the array of the dataitem to allocated
+   *  if it was allocated by COM, to user if it was set by the user, or to
+   *  inherited if it is used from a parent. The array shared by the
+   *  components of a dataitem is counted once, unless the components
+   *  were initialized individually.
+   */
+  void get_memory_usage(COM_Size &allocated, COM_Size &user,
+                        COM_Size &inherited) const;
+
   /// Check how the dataitem values are organized.
   /// It returns true if the components of the dataitem associated with
   //  a pane/node/element are not stored in consecutive memory space.
@@ -303,12 +318,12 @@ class DataItem {
 
   /// Set the size of items and ghost items. Can be changed only if the
   /// dataitem is a root.
-  void set_size(int nitems, int ngitems = 0);
+  void set_size(COM_Size nitems, COM_Size ngitems = 0);
 
   /// Allocate memory for the dataitem.
   /// The dataitem must be a root if the dataitem is to be allocated.
   /// If from is not NULL, copy its value to the newly allocated array.
-  void *allocate(int strd, int cap, bool force);
+  void *allocate(int strd, COM_Size cap, bool force);
 
   /// Deallocate memory if it was allocated by allocate().
   /// Return 0 if deallocation is successful.
@@ -317,20 +332,35 @@ class DataItem {
   enum Copy_dir { COPY_IN, COPY_OUT };
   // Copy n _ncomp-vectors from "buf" to the array if direction is COPY_IN
   // or copy to "buf" if direction is COPY_OUT.
-  void copy_array(void *buf, int strd, int nitem, int offset = 0,
+  void copy_array(void *buf, int strd, COM_Size nitem, COM_Size offset = 0,
                   int direction = COPY_IN);
 
   // Append n _ncomp-vectors from "from" to the array.
-  void append_array(const void *from, int strd, int nitem);
+  void append_array(const void *from, int strd, COM_Size nitem);
+
+  /** Exchange the arrays of two dataitems without copying, together with
+   *  their strides, capacities and ownership. Both dataitems must be roots
+   *  with the same type, number of components and number of items. The
+   *  dataitems using either of them see the exchanged arrays.
+   */
+  void swap_array(DataItem *a);
 
  protected:
   /// Set the physical address of the dataitem values.
-  void set_pointer(void *p, int strd, int cap, int offset, bool is_const);
+  void set_pointer(void *p, int strd, COM_Size cap, int offset, bool is_const);
 
   /// Inherit from parent. If depth>0, then the procedure is for the
   /// subcomponents.
   void inherit(DataItem *a, bool clone, bool withghost, int depth = 0);
 
+  /// Number of bytes of the array allocated for the dataitem.
+  std::size_t nbytes_allocated() const {
+    return std::size_t(_cap) * get_sizeof(_type, std::max(_strd, _ncomp));
+  }
+
+  /// Report a change of the memory allocated by COM to the window.
+  void record_memory(COM_Size delta);
+
  protected:
   Pane *_pane;        ///< Pointer to its owner pane.
   DataItem *_parent;  ///< Parent dataitem being used.
@@ -346,9 +376,9 @@ class DataItem {
   COM_Type _type;     ///< Base data type of the dataitem.
   std::string _unit;  ///< Unit of the dataitem.
 
-  int _nitems;   ///< Size of total items. Default value is -1.
-  int _ngitems;  ///< Size of ghost items
-  int _gap;      ///< Gap between the IDs of real and ghost items.
+  COM_Size _nitems;   ///< Size of total items. Default value is -1.
+  COM_Size _ngitems;  ///< Size of ghost items
+  COM_Size _gap;      ///< Gap between the IDs of real and ghost items.
 
   enum {
     STATUS_NOT_INITIALIZED = 0,
@@ -359,10 +389,11 @@ class DataItem {
   };
   Shorter_size _status;  ///< Indicating whether it has been initialized
 
-  void *_ptr;        ///< Physical address of the dataitem.
-  int _strd;         ///< Stride
-  int _nbytes_strd;  ///< Number of bytes of the stride
-  int _cap;          ///< Capacity
+  void *_ptr;         ///< Physical address of the dataitem.
+  int _strd;          ///< Stride
+  int _nbytes_strd;   ///< Number of bytes of the stride
+  COM_Size _cap;      ///< Capacity
+  Allocator *_alloc;  ///< Allocator of the array, if allocated by COM
 
   static const char *_keywords[COM_NUM_KEYWORDS];     ///< List of keywords
   static const char _keylocs[COM_NUM_KEYWORDS];       ///< Default locations
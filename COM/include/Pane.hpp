@@ -102,61 +102,63 @@ class Pane {
    * \{
    */
   /// Get the total number of nodes in the pane (including ghost nodes).
-  Size size_of_nodes() const { return _attr_set[COM_NC]->size_of_items(); }
+  COM_Size size_of_nodes() const { return _attr_set[COM_NC]->size_of_items(); }
 
   /// Get the maximum number of real nodes in the pane (excluding ghost nodes).
-  Size maxsize_of_nodes() const {
+  COM_Size maxsize_of_nodes() const {
     return _attr_set[COM_NC]->maxsize_of_items();
   }
 
   /// Get the number of ghost nodes
-  Size size_of_ghost_nodes() const {
+  COM_Size size_of_ghost_nodes() const {
     return _attr_set[COM_NC]->size_of_ghost_items();
   }
 
   /// Get the maximum number of real nodes in the pane (excluding ghost nodes).
-  Size maxsize_of_ghost_nodes() const {
+  COM_Size maxsize_of_ghost_nodes() const {
     return _attr_set[COM_NC]->maxsize_of_ghost_items();
   }
 
   /// Get the number of real nodes in the pane (excluding ghost nodes).
-  Size size_of_real_nodes() const {
+  COM_Size size_of_real_nodes() const {
     return _attr_set[COM_NC]->size_of_real_items();
   }
 
   /// Get the maximum number of real nodes in the pane (excluding ghost nodes).
-  Size maxsize_of_real_nodes() const {
+  COM_Size maxsize_of_real_nodes() const {
     return _attr_set[COM_NC]->maxsize_of_real_items();
   }
 
   /// Get the total number of elements in the pane (including ghost elements).
-  Size size_of_elements() const { return _attr_set[COM_CONN]->size_of_items(); }
+  COM_Size size_of_elements() const {
+    return _attr_set[COM_CONN]->size_of_items();
+  }
 
   /// Get the maximum number of elements allowed in the pane (including ghost
   /// elements)
-  Size maxsize_of_elements() const {
+  COM_Size maxsize_of_elements() const {
     return _attr_set[COM_CONN]->maxsize_of_items();
   }
 
   /// Get the total number of ghost elements
-  Size size_of_ghost_elements() const {
+  COM_Size size_of_ghost_elements() const {
     return _attr_set[COM_CONN]->size_of_ghost_items();
   }
 
   /// Get the maximum number of elements allowed in the pane (including ghost
   /// elements)
-  Size maxsize_of_ghost_elements() const {
+  COM_Size maxsize_of_ghost_elements() const {
     return _attr_set[COM_CONN]->maxsize_of_ghost_items();
   }
 
   /// Get the number of real elements in the pane (excluding ghost elements).
-  Size size_of_real_elements() const {
+  COM_Size size_of_real_elements() const {
     return _attr_set[COM_CONN]->size_of_real_items();
   }
 
   /// Get the maximum number of real elements allowed in the pane (excluding
   /// ghost elements).
-  Size maxsize_of_real_elements() const {
+  COM_Size maxsize_of_real_elements() const {
     return _attr_set[COM_CONN]->maxsize_of_real_items();
   }
 
@@ -288,7 +290,8 @@ class Pane {
   /// Delete an existing dataitem with given id.
   void delete_dataitem(int id);
 
-  void reinit_dataitem(int aid, OP_Init op, void **addr, int strd, int cap);
+  void reinit_dataitem(int aid, OP_Init op, void **addr, int strd,
+                       COM_Size cap);
 
   /// Obtain the connectivity with the given name.
   const Connectivity *connectivity(const std::string &a) const {
@@ -298,17 +301,17 @@ class Pane {
   Connectivity *connectivity(const std::string &a, bool insert = false);
 
   void reinit_conn(Connectivity *con, OP_Init op, int **addr, int strd,
-                   int cap);
+                   COM_Size cap);
 
   /// Inherit an dataitem from another pane onto the current pane:
   DataItem *inherit(DataItem *from, const std::string &aname, int mode,
                     bool withghost);
 
   /// Set the size of an dataitem
-  void set_size(DataItem *a, int nitems, int ng);
+  void set_size(DataItem *a, COM_Size nitems, COM_Size ng);
 
   /// Set the size of a connectivity table.
-  void set_size(Connectivity *con, int nitems, int ng);
+  void set_size(Connectivity *con, COM_Size nitems, COM_Size ng);
 
  protected:
   ComponentInterface *_window;  ///< Point to the parent window.
@@ -13,6 +13,8 @@
 #ifndef __COM_BASIC_H__
 #define __COM_BASIC_H__
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 /** \namespace COM
  *  The name space for COM.
@@ -103,6 +105,7 @@ typedef void (COM_Object::*COM_Member_func_ptr)();
 const int MAX_NAMELEN = 128;
 
 typedef int COM_Type;       /**< Indices for derived data types.*/
+typedef int64_t COM_Size;   /**< Numbers of items and capacities of arrays.*/
 typedef void (*Func_ptr)(); /**< Pointer of functions. */
 typedef Func_ptr COM_Func_ptr;
 
@@ -133,6 +133,15 @@ inline void COM_delete_pane(const char *str, int pid) {
 inline void COM_delete_pane(const std::string &str, int pid) {
   COM_get_com()->delete_pane(str, pid);
 }
+
+inline void COM_migrate_panes(const std::string &wname, int n,
+                              const int *pane_ids, const int *ranks) {
+  COM_get_com()->migrate_panes(wname, n, pane_ids, ranks);
+}
+
+inline int COM_rebalance_panes(const std::string &waname, double tol) {
+  return COM_get_com()->rebalance_panes(waname, tol);
+}
 #endif
 
 inline void COM_new_dataitem(const char *wa_str, const char loc, const int type,
@@ -158,14 +167,14 @@ inline void COM_delete_dataitem(const std::string &wa_str) {
 }
 #endif
 
-inline void COM_set_size(const char *wa_str, int pane_id, int size,
-                         int ng = 0) {
+inline void COM_set_size(const char *wa_str, int pane_id, COM_Size size,
+                         COM_Size ng = 0) {
   COM_get_com()->set_size(wa_str, pane_id, size, ng);
 }
 
 #ifndef C_ONLY
-inline void COM_set_size(const std::string &wa_str, int pane_id, int size,
-                         int ng = 0) {
+inline void COM_set_size(const std::string &wa_str, int pane_id,
+                         COM_Size size, COM_Size ng = 0) {
   COM_get_com()->set_size(wa_str, pane_id, size, ng);
 }
 
@@ -185,24 +194,26 @@ inline void COM_get_object(const std::string &wa_str, int pane_id,
 #endif
 
 inline void COM_set_array(const char *wa_str, int pane_id, void *addr,
-                          int strd = 0, int cap = 0) {
+                          int strd = 0, COM_Size cap = 0) {
   COM_get_com()->set_array(wa_str, pane_id, addr, strd, cap);
 }
 
 inline void COM_set_array_const(const char *wa_str, int pane_id,
-                                const void *addr, int strd = 0, int cap = 0) {
+                                const void *addr, int strd = 0,
+                                COM_Size cap = 0) {
   COM_get_com()->set_array(wa_str, pane_id, const_cast<void *>(addr), strd, cap,
                            true);
 }
 
 #ifndef C_ONLY
 inline void COM_set_array(const std::string &wa_str, int pane_id, void *addr,
-                          int strd = 0, int cap = 0) {
+                          int strd = 0, COM_Size cap = 0) {
   COM_get_com()->set_array(wa_str, pane_id, addr, strd, cap);
 }
 
 inline void COM_set_array_const(const std::string &wa_str, int pane_id,
-                                const void *addr, int strd = 0, int cap = 0) {
+                                const void *addr, int strd = 0,
+                                COM_Size cap = 0) {
   COM_get_com()->set_array(wa_str, pane_id, const_cast<void *>(addr), strd, cap,
                            true);
 }
@@ -227,35 +238,39 @@ inline void COM_set_bounds(const char *wa_str, int pane_id, Type lbound,
 #endif
 
 inline void COM_allocate_array(const char *wa_str, int pane_id = 0,
-                               void **addr = NULL, int strd = 0, int cap = 0) {
+                               void **addr = NULL, int strd = 0,
+                               COM_Size cap = 0) {
   COM_get_com()->allocate_array(wa_str, pane_id, addr, strd, cap);
 }
 
 inline void COM_resize_array(const char *wa_str, int pane_id = 0,
-                             void **addr = NULL, int strd = -1, int cap = 0) {
+                             void **addr = NULL, int strd = -1,
+                             COM_Size cap = 0) {
   COM_get_com()->resize_array(wa_str, pane_id, addr, strd, cap);
 }
 
 #ifndef C_ONLY
 inline void COM_allocate_array(const std::string &wa_str, int pane_id = 0,
-                               void **addr = NULL, int strd = 0, int cap = 0) {
+                               void **addr = NULL, int strd = 0,
+                               COM_Size cap = 0) {
   COM_get_com()->allocate_array(wa_str, pane_id, addr, strd, cap);
 }
 
 inline void COM_resize_array(const std::string &wa_str, int pane_id = 0,
-                             void **addr = NULL, int strd = -1, int cap = 0) {
+                             void **addr = NULL, int strd = -1,
+                             COM_Size cap = 0) {
   COM_get_com()->resize_array(wa_str, pane_id, addr, strd, cap);
 }
 #endif
 
 inline void COM_append_array(const char *wa_str, int pane_id, const void *val,
-                             int v_strd, int v_size) {
+                             int v_strd, COM_Size v_size) {
   COM_get_com()->append_array(wa_str, pane_id, val, v_strd, v_size);
 }
 
 #ifndef C_ONLY
 inline void COM_append_array(const std::string &wa_str, int pane_id,
-                             const void *val, int v_strd, int v_size) {
+                             const void *val, int v_strd, COM_Size v_size) {
   COM_get_com()->append_array(wa_str, pane_id, val, v_strd, v_size);
 }
 #endif
@@ -309,6 +324,10 @@ inline void COM_copy_dataitem_handles(int trg_hdl, int src_hdl, int wg,
 }
 #endif
 
+inline void COM_swap_arrays(int hdl1, int hdl2) {
+  COM_get_com()->swap_arrays(hdl1, hdl2);
+}
+
 inline void COM_deallocate_array(const char *wa_str, const int pid = 0) {
   COM_get_com()->deallocate_array(wa_str, pid);
 }
@@ -334,6 +353,16 @@ inline void COM_get_size(const std::string &wa_str, int pane_id, int *size,
                          int *ng = nullptr) {
   COM_get_com()->get_size(wa_str, pane_id, size, ng);
 }
+
+inline void COM_get_size(const char *wa_str, int pane_id, COM_Size *size,
+                         COM_Size *ng = nullptr) {
+  COM_get_com()->get_size(wa_str, pane_id, size, ng);
+}
+
+inline void COM_get_size(const std::string &wa_str, int pane_id,
+                         COM_Size *size, COM_Size *ng = nullptr) {
+  COM_get_com()->get_size(wa_str, pane_id, size, ng);
+}
 #endif
 
 #ifndef C_ONLY
@@ -349,6 +378,17 @@ inline void COM_get_array_const(const char *wa_str, int pane_id,
                                 int *cap = nullptr) {
   COM_get_com()->get_array(wa_str, pane_id, (void **)addr, strd, cap, true);
 }
+template <class Type>
+inline void COM_get_array(const char *wa_str, int pane_id, Type **addr,
+                          int *strd, COM_Size *cap) {
+  COM_get_com()->get_array(wa_str, pane_id, reinterpret_cast<void **>(addr),
+                           strd, cap);
+}
+template <class Type>
+inline void COM_get_array_const(const char *wa_str, int pane_id,
+                                const Type **addr, int *strd, COM_Size *cap) {
+  COM_get_com()->get_array(wa_str, pane_id, (void **)addr, strd, cap, true);
+}
 #else
 inline void COM_get_array(const char *wa_str, int pane_id, void **addr,
                           int *strd = NULL, int *cap = NULL) {
@@ -363,7 +403,8 @@ inline void COM_get_array_const(const char *wa_str, int pane_id,
 #endif
 
 inline void COM_copy_array(const char *wa_str, int pane_id, void *val,
-                           int v_strd = 0, int v_size = 0, int offset = 0) {
+                           int v_strd = 0, COM_Size v_size = 0,
+                           COM_Size offset = 0) {
   COM_get_com()->copy_array(wa_str, pane_id, val, v_strd, v_size, offset);
 }
 
@@ -417,6 +458,35 @@ inline void COM_set_member_function(const std::string &wf_str,
 inline void COM_get_communicator(const std::string &wname, MPI_Comm *comm) {
   *comm = COM_get_com()->get_communicator(wname);
 }
+
+inline void COM_set_allocator(const std::string &wname, COM::Allocator *a) {
+  COM_get_com()->set_allocator(wname, a);
+}
+
+inline void COM_get_memory_usage(const std::string &waname, int pane_id,
+                                 COM_Size *allocated, COM_Size *user = NULL,
+                                 COM_Size *inherited = NULL) {
+  COM_get_com()->get_memory_usage(waname, pane_id, allocated, user, inherited);
+}
+
+inline void COM_get_memory_peak(const std::string &wname, COM_Size *current,
+                                COM_Size *peak) {
+  COM_get_com()->get_memory_peak(wname, current, peak);
+}
+
+inline void COM_reset_memory_peak(const std::string &wname) {
+  COM_get_com()->reset_memory_peak(wname);
+}
+
+inline void COM_set_memory_trace(const std::string &wname, std::ostream *os) {
+  COM_get_com()->set_memory_trace(wname, os);
+}
+
+inline void COM_print_memory_usage(const std::string &wname,
+                                   const std::string &fname = "",
+                                   const std::string &header = "") {
+  COM_get_com()->print_memory_usage(wname, fname, header);
+}
 #endif
 
 inline void COM_set_member_function(const char *wf_str, Func_ptr func,
@@ -126,6 +126,20 @@ public:
    */
   void set_name(const std::string &name) { action_name = name; }
 
+  /**
+   * Can the Action be run on a worker thread of a Scheduler in PARALLEL
+   * execution mode? Actions are not thread-safe by default, and must be run
+   * on the thread that calls Scheduler::run_actions().
+   * @return True if the Action is thread-safe.
+   */
+  bool is_thread_safe() const { return thread_safe; }
+  /**
+   * Declare whether the Action is thread-safe, i.e., its run() may be called
+   * on a worker thread concurrently with the independent Actions.
+   * @param flag True if the Action is thread-safe.
+   */
+  void set_thread_safe(bool flag) { thread_safe = flag; }
+
 protected:
   /**
    * Get DataItem handle if OUT, or const handle if IN, from COM.
@@ -138,6 +152,7 @@ protected:
 protected:
   std::string action_name; ///< Action name
   ActionDataList action_data; ///< List of ActionData
+  bool thread_safe;           ///< flag: may run on a worker thread
 };
 
 #endif // _IMPACT_ACTION_H_
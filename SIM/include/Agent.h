@@ -239,6 +239,14 @@ public:
    * @return MPI rank
    */
   int get_comm_rank() const { return comm_rank; }
+  /**
+   * Does the Agent run on this process? An Agent constructed with
+   * MPI_COMM_NULL belongs to a group of processes excluding this one (see
+   * Coupling::split_communicator()). Its module is not loaded here and the
+   * Coupling skips it, so agents on disjoint groups run concurrently.
+   * @return True if this process is in the communicator of the Agent.
+   */
+  bool is_active() const { return communicator != MPI_COMM_NULL; }
   /**
    * Get physics module library name
    * @return
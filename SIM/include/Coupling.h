@@ -25,6 +25,13 @@
  * respectively. The run() procedure will take the current time and
  * pre-determined time step, run the Scheduler with the main physics Action from
  * each Agent, and return the new time.
+ *
+ * The agents may live on disjoint groups of processes, each Agent being
+ * constructed with the sub-communicator of its group, or MPI_COMM_NULL on the
+ * processes outside it (see split_communicator()). The agents then run
+ * concurrently, and the Coupling agrees on the time step and on the
+ * predictor-corrector convergence over its whole communicator. Data on the
+ * interfaces is moved between the groups with GroupTransfer actions.
  */
 class Coupling : public COM_Object {
 public:
@@ -57,6 +64,20 @@ public:
    * @return returns pointer to added Agent
    */
   Agent *add_agent(Agent *);
+  /**
+   * Split a communicator into disjoint groups of processes, one per Agent,
+   * with a number of processes roughly proportional to the cost of the
+   * Agent. Each group has at least one process, and the groups are
+   * contiguous ranges of ranks in the order of costs. This is a collective
+   * call.
+   * @param comm communicator of the Coupling
+   * @param costs relative cost of each group
+   * @param group the group of this process
+   * @return sub-communicator of the group of this process
+   */
+  static MPI_Comm split_communicator(MPI_Comm comm,
+                                     const std::vector<double> &costs,
+                                     int *group);
   ///@}
 
   /**
@@ -191,6 +212,7 @@ protected:
   AgentList agents;                ///< List of all agents registered
   MPI_Comm communicator;           ///< MPI Communicator
   int comm_rank;                   ///< MPI rank
+  bool split_groups{false};        ///< agents on sub-communicators
   std::vector<std::string> modules;
   ///@}
 
@@ -0,0 +1,72 @@
+#ifndef _IMPACT_DATAITEMHISTORY_H_
+#define _IMPACT_DATAITEMHISTORY_H_
+
+#include <string>
+#include <vector>
+
+/**
+ * DataItemHistory keeps the time levels of a DataItem as a ring buffer.
+ *
+ * The levels are DataItems of the same type and sizes, newest first, e.g.,
+ * "win.attr" and "win.attr_old". Advancing the history with rotate()
+ * exchanges the arrays of the levels with COM_swap_arrays() instead of
+ * copying the values: level k takes the array of level k-1, and level 0
+ * takes the array of the oldest level. The values of level 0 are then
+ * stale and must be overwritten before they are read.
+ *
+ * The windows using the levels (see COM_use_dataitem()) follow the exchanged
+ * arrays, but a module caching the addresses of the arrays does not. A
+ * level must own its arrays, i.e., they must not be used from another
+ * window (see can_rotate()), and no module may cache their addresses.
+ */
+class DataItemHistory {
+public:
+  DataItemHistory() = default;
+  /**
+   * Construct a history from COM handles
+   * @param hdls mutable DataItem handles of the levels, newest first
+   */
+  explicit DataItemHistory(std::vector<int> hdls) : levels(std::move(hdls)) {}
+
+  /**
+   * Set the levels of the history.
+   * @param hdls mutable DataItem handles of the levels, newest first
+   */
+  void set_levels(std::vector<int> hdls) { levels = std::move(hdls); }
+  /**
+   * Get the number of levels.
+   * @return number of levels
+   */
+  int size() const { return levels.size(); }
+  /**
+   * Is the history empty?
+   * @return True if there are no levels.
+   */
+  bool empty() const { return levels.empty(); }
+
+  /**
+   * Advance to a new time level: level k takes the array of level k-1, and
+   * level 0 the array of the oldest level.
+   */
+  void rotate();
+  /**
+   * Undo rotate(): level k takes the array of level k+1, and the oldest
+   * level the array of level 0.
+   */
+  void rotate_back();
+
+  /**
+   * Check whether the arrays of a DataItem are allocated by COM on all
+   * local panes. This only means that COM owns the memory; the caller must
+   * also guarantee that no module caches the addresses of the arrays, which
+   * change at every rotate().
+   * @param attr DataItem ("window.attr")
+   * @return True if the DataItem exists and its arrays are allocated by COM.
+   */
+  static bool can_rotate(const std::string &attr);
+
+private:
+  std::vector<int> levels; ///< COM handles of the levels, newest first
+};
+
+#endif //_IMPACT_DATAITEMHISTORY_H_
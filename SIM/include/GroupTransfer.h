@@ -0,0 +1,112 @@
+#ifndef _IMPACT_GROUPTRANSFER_H_
+#define _IMPACT_GROUPTRANSFER_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Action.h"
+#include "com.h"
+
+/**
+ * GroupTransfer copies a DataItem between Agent on disjoint groups of
+ * processes (see Coupling::split_communicator()).
+ *
+ * The source and target windows must have the same panes with the same
+ * numbers of items (including ghosts), and the DataItems must have the same
+ * type and number of components, e.g., the target is a buffer replicating
+ * the interface mesh of the source. The layouts of the components may
+ * differ: each pane is sent as one message in which the components of each
+ * item are contiguous, packing and unpacking staggered or strided arrays.
+ * Each pane is sent point-to-point from the process owning it in the source
+ * window to the process owning it in the target window, over the
+ * communicator of the Coupling. The owners of the panes are exchanged and
+ * checked once in init(), which is a collective call on the communicator.
+ * The processes owning neither window do nothing in run().
+ */
+class GroupTransfer : public Action {
+public:
+  /**
+   * Construct a GroupTransfer
+   * @param src source DataItem ("window.attr")
+   * @param trg target DataItem ("window.attr")
+   * @param com MPI communicator containing both groups
+   * @param name action name (Default: "GroupTransfer")
+   */
+  GroupTransfer(const std::string &src, const std::string &trg, MPI_Comm com,
+                std::string name = "GroupTransfer");
+
+  void init(double t) override;
+  void run(double t, double dt, double alpha) override;
+  void finalize() override {}
+
+private:
+  /// A pane of a DataItem and the process owning it
+  struct PaneInfo {
+    int pane_id; ///< pane ID
+    int rank;    ///< rank of the owning process
+    int type;    ///< data type of the DataItem
+    int ncomp;   ///< number of components of the DataItem
+    int nitems;  ///< number of items, including ghosts
+    int nghosts; ///< number of ghost items
+
+    bool operator<(const PaneInfo &p) const { return pane_id < p.pane_id; }
+  };
+
+  /**
+   * Find the process owning each pane of a DataItem over the communicator.
+   * @param attr DataItem ("window.attr"), whose window may not exist on this
+   *             process
+   * @param local panes of the window on this process, sorted by pane ID
+   * @param owners panes of the window on all processes, sorted by pane ID
+   */
+  void find_owners(const std::string &attr, std::vector<int> &local,
+                   std::vector<PaneInfo> &owners) const;
+
+  /**
+   * Match each local pane of one DataItem with the same pane of the other.
+   * Aborts if a pane is missing or has a different type, number of
+   * components or number of items.
+   * @param attr DataItem ("window.attr") of the local panes
+   * @param other_attr the other DataItem ("window.attr")
+   * @param local panes of the DataItem on this process
+   * @param own panes of the DataItem on all processes
+   * @param other panes of the other DataItem on all processes
+   * @param pairs pane ID and rank owning it in the other DataItem
+   */
+  void match_panes(const std::string &attr, const std::string &other_attr,
+                   const std::vector<int> &local,
+                   const std::vector<PaneInfo> &own,
+                   const std::vector<PaneInfo> &other,
+                   std::vector<std::pair<int, int>> &pairs) const;
+
+  /**
+   * Get the array of a DataItem on a pane if its components are
+   * contiguous for each item, i.e., it can be sent or received in place.
+   * @param attr DataItem ("window.attr")
+   * @param pane_id pane ID
+   * @param nbytes size in bytes of the items
+   * @return address of the array, or nullptr if it must be packed
+   */
+  static void *get_contiguous(const std::string &attr, int pane_id,
+                              int &nbytes);
+
+  /**
+   * Copy the items of a DataItem on a pane between its arrays and a buffer
+   * in which the components of each item are contiguous.
+   * @param attr DataItem ("window.attr")
+   * @param pane_id pane ID
+   * @param buf buffer of the items
+   * @param pack copy into buf if true, and out of buf otherwise
+   */
+  static void copy_items(const std::string &attr, int pane_id, char *buf,
+                         bool pack);
+
+private:
+  MPI_Comm communicator; ///< MPI Communicator containing both groups
+
+  std::vector<std::pair<int, int>> sends; ///< pane ID and target rank
+  std::vector<std::pair<int, int>> recvs; ///< pane ID and source rank
+};
+
+#endif //_IMPACT_GROUPTRANSFER_H_
@@ -2,6 +2,7 @@
 #define _INTERPOLATE_H_
 
 #include "Action.h"
+#include "DataItemHistory.h"
 
 class Agent;
 
@@ -24,6 +25,17 @@ public:
   // BACKUP in "man_basic.f90"
   void backup();
 
+  /**
+   * Rotate the arrays of the attribute and its backup instead of copying
+   * them in backup(). Only valid if the attribute is overwritten before it
+   * is read again after the backup, e.g., by a transfer. Falls back to
+   * copying unless both arrays are allocated by COM. The caller must also
+   * guarantee that no module caches the addresses of the arrays, since
+   * they change at every backup.
+   * @param b True to rotate
+   */
+  void set_rotating_backup(bool b) { rotating = b; }
+
 protected:
   static void extrapolate_Linear(double dt, double dt_old, double time_old,
                                  int a_old, double time_new, int a_new,
@@ -34,6 +46,8 @@ protected:
   Agent *bkagent;   ///< Agent providing backup
   int attr_hdls[4]; ///< COM handles for interpolation attributes
   int bkup_hdls[3]; ///< COM handles for backup attributes
+  DataItemHistory history; ///< attribute and backup for rotating backup
+  bool rotating{false};    ///< rotate instead of copy in backup()
   bool conditional; ///< conditional action, check alp for on/off
   int order;        ///< interpolation order
 };
@@ -4,6 +4,7 @@
 #include <cstdio>
 
 #include "Action.h"
+#include "com.h"
 
 class Scheduler;
 typedef void (Scheduler::*Scheduler_voidfn1_t)(double);
@@ -22,6 +23,11 @@ typedef void (Scheduler::*Scheduler_voidfn1_t)(double);
  *
  * The functions init_actions(), run_actions(), and finalize_actions()
  * correspond to the Action equivalents.
+ *
+ * By default, run_actions() runs the actions one at a time in the topological
+ * sort order. In PARALLEL execution mode (see set_execution_mode()), an action
+ * is started as soon as all the actions it reads from have completed, so that
+ * independent actions run concurrently on a pool of worker threads.
  */
 class Scheduler {
 public:
@@ -39,6 +45,14 @@ public:
   virtual ~Scheduler();
 
 public:
+  /**
+   * How run_actions() executes the actions.
+   */
+  enum ExecutionMode {
+    SERIAL,  ///< one at a time in topological sort order (Default)
+    PARALLEL ///< concurrently on a thread pool following the dependencies
+  };
+
   /**
    * Determines the order Actions will be run. Must be called after
    * add_actions() and before init_actions(), run_actions(), or
@@ -82,6 +96,76 @@ public:
    */
   void finalize_actions();
 
+  /**
+   * Select the execution mode of run_actions(). In PARALLEL mode, only the
+   * actions declared thread-safe (see Action::set_thread_safe()) are run on
+   * the worker threads; all other actions are run on the thread calling
+   * run_actions(). init_actions() and finalize_actions() are always serial.
+   * @param mode execution mode
+   * @param nthreads number of threads including the calling thread
+   *                 (Default: 0, the number of hardware threads)
+   */
+  void set_execution_mode(ExecutionMode mode, int nthreads = 0);
+  /**
+   * Get the execution mode of run_actions().
+   * @return execution mode
+   */
+  ExecutionMode execution_mode() const { return exec_mode; }
+  /**
+   * Get the number of threads used in PARALLEL execution mode.
+   * @return number of threads including the calling thread
+   */
+  int num_threads() const { return n_threads; }
+
+  /**
+   * Print the timing of the last call of run_actions() to C-style stream:
+   * the start and wall time of each action, the actions on the critical
+   * path (marked by '*'), and the call counts and mean times since the last
+   * reset_timing().
+   * @param f C stream
+   */
+  void print_timing(FILE *f) const;
+  /**
+   * Print the accumulated wall time of each action, with its minimum,
+   * average, and maximum across the processes of a communicator. This is a
+   * collective call; only the process of rank 0 prints.
+   * @param f C stream
+   * @param comm MPI communicator
+   */
+  void print_timing_stats(FILE *f, MPI_Comm comm) const;
+  /**
+   * Write the accumulated timing of each action to a CSV file.
+   * @param fname file name
+   */
+  void write_timing_csv(const char *fname) const;
+  /**
+   * Clear the accumulated timing and the recorded trace.
+   */
+  void reset_timing();
+
+  /**
+   * Compute the critical path of the last call of run_actions(), i.e., the
+   * chain of dependent actions with the largest total wall time.
+   * @param path if not null, the names of the actions on the path in order
+   * @return total wall time of the actions on the critical path
+   */
+  double critical_path(std::vector<std::string> *path = nullptr) const;
+
+  /**
+   * Enable or disable recording a trace of all runs of the actions, to be
+   * written by write_chrome_trace(). The trace grows with every call of
+   * run_actions() until reset_timing() is called.
+   * @param flag True to record a trace
+   */
+  void set_trace(bool flag) { tracing = flag; }
+  /**
+   * Write the recorded trace in the Chrome trace event format (JSON), which
+   * can be viewed with chrome://tracing or Perfetto.
+   * @param fname file name
+   * @param pid process id shown in the trace (e.g., the MPI rank)
+   */
+  void write_chrome_trace(const char *fname, int pid = 0) const;
+
   /**
    * Print to file in GDL.
    * @param fname file name
@@ -132,7 +216,9 @@ protected:
    * ActionItem stores an Action and its input/output links to other Action.
    */
   struct ActionItem {
-    explicit ActionItem(Action *a) : myaction(a), print_flag(0) {}
+    explicit ActionItem(Action *a)
+        : myaction(a), print_flag(0), n_pred(0), n_pending(0), start_time(0),
+          run_time(0), thread(0), n_calls(0), total_time(0), max_time(0) {}
 
     /**
      * Access contained action
@@ -210,6 +296,18 @@ protected:
     ActionList output; // write_n
 
     mutable int print_flag; // for print
+
+    ActionList succ; // distinct actions reading from this action
+    int n_pred;      // number of distinct actions this action reads from
+    int n_pending;   // inputs not yet completed in the current run
+
+    double start_time; // start of the last run, from start of run_actions()
+    double run_time;   // wall time of the last run
+    int thread;        // thread of the last run (0 is the calling thread)
+
+    int n_calls;       // number of runs since the last reset_timing()
+    double total_time; // total wall time since the last reset_timing()
+    double max_time;   // largest wall time since the last reset_timing()
   };
 
 protected:
@@ -219,6 +317,18 @@ protected:
    */
   void printActions(FILE *f) const;
 
+  /**
+   * Run an action and record its timing.
+   * @param aitem ActionItem
+   * @param tid thread index (0 is the thread calling run_actions())
+   * @param t0 start time of run_actions() (seconds)
+   * @param t current time
+   * @param dt time step
+   * @param alpha interpolation sub step
+   */
+  static void run_item(ActionItem *aitem, int tid, double t0, double t,
+                       double dt, double alpha);
+
 protected:
   std::string scheduler_name; ///< name of the Scheduler
 
@@ -232,6 +342,46 @@ protected:
   bool verbose; ///< flag: verbosity (Default: false)
 
 private:
+  /**
+   * Thread pool running the actions in PARALLEL execution mode.
+   */
+  class Executor;
+
+  /**
+   * Compute the successors and number of predecessors of each action from
+   * the input links.
+   */
+  void build_dependencies();
+  /**
+   * Compute the critical path of the last call of run_actions().
+   * @param path the actions on the path in order
+   * @return total wall time of the actions on the critical path
+   */
+  double critical_items(ActionList &path) const;
+
+  ExecutionMode exec_mode; ///< execution mode of run_actions()
+  int n_threads;           ///< number of threads in PARALLEL mode
+  Executor *executor;      ///< created on first run in PARALLEL mode
+  bool deps_built;         ///< flag: true if build_dependencies() called
+  double run_wtime;        ///< wall time of the last run_actions()
+  int n_runs;              ///< calls of run_actions() since reset_timing()
+  double total_wtime;      ///< wall time of run_actions() since reset_timing()
+
+  /**
+   * A complete event of the Chrome trace format.
+   */
+  struct TraceEvent {
+    const ActionItem *aitem;
+    double start;    ///< seconds from trace_origin
+    double duration; ///< seconds
+    int thread;
+  };
+
+  bool tracing;                  ///< flag: true if recording a trace
+  double trace_origin;           ///< start of the first traced run
+  std::vector<TraceEvent> trace; ///< recorded trace
+
+
   /**
    * Helper function to print ActionItem to C-style stream
    * @param f C stream
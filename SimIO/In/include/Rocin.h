@@ -172,6 +172,12 @@ class Rocin : public COM_Object {
   void blockcyclic_local(const int &pid, const int &comm_rank,
                          const int &comm_size, int *il);
 
+  /// Selected by @Balanced in a control file.  The owners are computed
+  /// by register_panes from the sizes and adjacency of all the panes, so
+  /// every process must scan the same files (e.g. with @Proc: *).
+  void balanced_local(const int &pid, const int &comm_rank,
+                      const int &comm_size, int *il);
+
   void register_panes(
 #ifdef USE_HDF4
                       BlockMM_HDF4::iterator hdf4,
@@ -217,6 +223,7 @@ class Rocin : public COM_Object {
  protected:
   MemberRulePtr m_is_local;
   std::set<int> m_pane_ids;
+  std::map<int, int> m_pane_owner;  ///< Owner process of each pane.
   int m_base;
   int m_offset;
 
@@ -9,54 +9,51 @@
 #define _KD_TREE_3_
 
 #include <cassert>
-
+#include <vector>
+
+/** A kd-tree for range and nearest-neighbor queries of points in 3-D.
+ *
+ *  The queries that take an output vector are const and may be issued
+ *  concurrently from multiple threads. The legacy queries that return a
+ *  pointer to an internal buffer are not thread-safe.
+ *
+ *  When compiled with OpenMP (see ENABLE_OPENMP), the tree is built and
+ *  the batched queries are answered with multiple threads. The tree and
+ *  the query results do not depend on the number of threads.
+ */
 class KD_tree_3 {
  public:
-  KD_tree_3() : _npnts(0), _maxout(0), _tree(0), _bboxes(0), _indices(0) {}
+  KD_tree_3() : _npnts(0) {}
 
-  KD_tree_3(const double *pnts, int np, int maxn = 0)
-      : _npnts(0), _maxout(0), _tree(0), _bboxes(0), _indices(0) {
+  KD_tree_3(const double *pnts, int np, int maxn = 0) : _npnts(0) {
     build(pnts, np, maxn);
   }
 
-  ~KD_tree_3() {
-    if (_tree) {
-      delete[] _tree;
-      _tree = 0;
-    }
-    if (_bboxes) {
-      delete[] _bboxes;
-      _bboxes = 0;
-    }
-    if (_indices) {
-      delete[] _indices;
-      _indices = 0;
-    }
-  }
-
   /* Public interface for building kdtree.
    * Give points should have format equivalent to double[npnts][3].
-   * It also takes an optional argument maxn to specify the maximum
+   * It also takes an optional argument maxn to give a hint of the maximum
    * number of points that can be returned by search.
    */
   void build(const double *pnts, int np, int maxn = 0) {
     assert(np >= 0);
     _npnts = np;
-    if (maxn)
-      _maxout = maxn;
-    else
-      _maxout = np;
+    _tree.clear();
+    _bboxes.clear();
+    _indices.clear();
+    if (maxn) _indices.reserve(maxn);
 
     if (_npnts) {
-      _tree = new int[2 * _npnts - 1];
-      _bboxes = new double[12 * _npnts - 6];
+      _tree.resize(2 * _npnts - 1);
+      _bboxes.resize(12 * _npnts - 6);
 
+      /* Also computes the exact bboxes of the nodes */
       kdtree_build_3(pnts, _npnts);
-      /* Compute bboxes in linear time */
-      kdtree_bboxes_3(pnts);
     }
   }
 
+  /// Number of points in the tree.
+  int size() const { return _npnts; }
+
   /* Public interface for range search.
    * range is specified as {minx, miny, minz, maxx, maxy, maxz}.
    * If indices is given as second argument, then point to buffer space
@@ -64,13 +61,11 @@ class KD_tree_3 {
    * This function must be called after build has been called.
    */
   int search(const double range[6], int **indices = 0, int start = 0) {
-    assert(_tree);
-    if (_npnts == 0) return 0;
-
-    if (!_indices) _indices = new int[_maxout];
-    if (indices) *indices = _indices;
+    _indices.clear();
+    int nfound = kdtree_search_3(range, start, _indices);
+    if (indices) *indices = _indices.empty() ? 0 : &_indices[0];
 
-    return kdtree_search_3(range, start);
+    return nfound;
   }
 
   /* Public interface for range search.
@@ -82,54 +77,105 @@ class KD_tree_3 {
   int search(const double pnt[3], const double tol, int **indices = 0,
              int start = 0) {
     double range[6];
+    make_range(pnt, tol, range);
 
-    for (int k = 0; k < 3; ++k) {
-      range[k] = pnt[k] - tol;
-      range[3 + k] = pnt[k] + tol;
-    }
+    return search(range, indices, start);
+  }
 
-    if (!_indices) _indices = new int[_maxout];
-    if (indices) *indices = _indices;
+  /* Thread-safe range search, which saves the indices of the points
+   * within range {minx, miny, minz, maxx, maxy, maxz} into indices.
+   */
+  int search(const double range[6], std::vector<int> &indices,
+             int start = 0) const {
+    indices.clear();
+    return kdtree_search_3(range, start, indices);
+  }
 
-    return kdtree_search_3(range, start);
+  /* Thread-safe range search, which saves the indices of the points
+   * within distance tol of pnt along each axis into indices.
+   */
+  int search(const double pnt[3], const double tol, std::vector<int> &indices,
+             int start = 0) const {
+    double range[6];
+    make_range(pnt, tol, range);
+
+    return search(range, indices, start);
   }
 
+  /* Batched range search for np query points, given in the format
+   * equivalent to double[np][3]. The indices of the points within
+   * distance tol of the ith query point along each axis are saved into
+   * indices[offsets[i]] to indices[offsets[i+1]-1], in the same order as
+   * search returns them. It returns the total number of points found.
+   */
+  int search_batch(const double *pnts, int np, const double tol,
+                   std::vector<int> &offsets, std::vector<int> &indices,
+                   int start = 0) const;
+
+  /* Search for the points within the Euclidean distance r of pnt, and
+   * save their indices into indices. It returns the number of points.
+   */
+  int search_radius(const double pnt[3], const double r,
+                    std::vector<int> &indices, int start = 0) const;
+
+  /* Search for the k points nearest to pnt, and save their indices into
+   * indices in increasing order of the distance, with ties broken by
+   * indices. If sqdists is given, the squared distances are saved into
+   * it. It returns the number of points found, which is min(k, size()).
+   */
+  int nearest(const double pnt[3], int k, std::vector<int> &indices,
+              std::vector<double> *sqdists = 0, int start = 0) const;
+
  protected:
   /*************************************************************
    *
    * FUNCTION: kdtree_build_3
    *
-   * Build a kd-tree for a given set of points in 3-D.
+   * Build a kd-tree for a given set of points in 3-D, and compute
+   * the bboxes of its nodes.
    *************************************************************/
   void kdtree_build_3(const double *xs, int npoints);
 
   /*************************************************************
    *
-   * FUNCTION: kdtree_bboxes_3
+   * FUNCTION: kdtree_split_3
    *
-   * Compute bboxes of nodes of kdtree in linear time.
+   * Build the subtree rooted at an internal node for n>=2 points
+   * given by points, whose descendants occupy the nodes starting at
+   * next. On entry, the bbox of the node approximates the points,
+   * and on exit it is exact.
    *
-   * See also  kdtree_search_3, kdtree_build_3
+   * See also kdtree_build_3
    *************************************************************/
-  void kdtree_bboxes_3(const double *xs);
+  void kdtree_split_3(const double *xs, int *points, int n, int node,
+                      int next);
 
   /*************************************************************
    *
    * FUNCTION: kdtree_search_3
    *
    * Search the k-D tree structure to find points contained whtinin a
-   * given range. It returns the number if points found and saves
-   * the indices of points into _indices.
+   * given range. It returns the number if points found and appends
+   * the indices of points to indices.
    *
-   * See also kdtree_build_3, kdtree_bboxes_3
+   * See also kdtree_build_3
    *************************************************************/
-  int kdtree_search_3(const double range[6], int start);
+  int kdtree_search_3(const double range[6], int start,
+                      std::vector<int> &indices) const;
+
+ private:
+  static void make_range(const double pnt[3], double tol, double range[6]) {
+    for (int k = 0; k < 3; ++k) {
+      range[k] = pnt[k] - tol;
+      range[3 + k] = pnt[k] + tol;
+    }
+  }
 
  private:
-  int _npnts, _maxout;
-  int *_tree;
-  double *_bboxes;
-  int *_indices;
+  int _npnts;
+  std::vector<int> _tree;
+  std::vector<double> _bboxes;
+  std::vector<int> _indices;
 };
 
 #endif
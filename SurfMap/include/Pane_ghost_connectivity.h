@@ -9,6 +9,9 @@
  * Utility for constructing pane ghost connecvtivities in parallel.
  */
 
+#ifndef _PANE_GHOST_CONNECTIVITY_H_
+#define _PANE_GHOST_CONNECTIVITY_H_
+
 #include <algorithm>
 #include <deque>
 #include <iomanip>
@@ -54,6 +57,19 @@ using std::vector;
 
 class Pane_ghost_connectivity {
  public:
+  /** Integer lists exchanged between the local panes and their
+   * communicating panes, stored back to back in a single buffer. The list
+   * of the i-th local pane for its j-th communicating pane is the k-th
+   * list, where k = cpane_index(i, j).
+   */
+  struct Pane_lists {
+    std::vector<int> data;     // Concatenated lists
+    std::vector<int> offsets;  // Start of each list, followed by data.size()
+
+    const int *begin(int k) const { return data.data() + offsets[k]; }
+    int size(int k) const { return offsets[k + 1] - offsets[k]; }
+  };
+
   /// Constructors
   explicit Pane_ghost_connectivity(COM::Window *window) {
     _buf_window = window;
@@ -62,8 +78,19 @@ class Pane_ghost_connectivity {
 
   ~Pane_ghost_connectivity() { ; }
 
+  /// Compute the shared-node pconn and build a ghost layer on all panes.
   void build_pconn();
 
+  /** Rebuild the ghost layer only around panes whose mesh changed.
+   *
+   * changed lists the local panes whose real nodes or elements changed
+   * since the last build. These panes and the panes sharing nodes with
+   * them get a new ghost layer; the pconn of the other panes is kept.
+   * The shared-node part of the pconn must still be valid, so nodes on
+   * pane boundaries must keep their IDs. Must be called collectively.
+   */
+  void build_pconn(const std::vector<int> &changed);
+
   void init();
 
   // Get a total ordering of nodes
@@ -80,16 +107,14 @@ class Pane_ghost_connectivity {
    * sections of the pconn.
    */
   void get_ents_to_send(
-      vector<vector<vector<int> > > &gelem_lists,
+      Pane_lists &gelem_lists,
       vector<vector<map<pair<int, int>, int> > > &nodes_to_send,
-      vector<vector<deque<int> > > &elems_to_send,
-      vector<vector<int> > &comm_sizes);
+      vector<vector<deque<int> > > &elems_to_send);
 
   // Determine # of ghost nodes to receive and map (P,N) to ghost node ids
   // Also determine # ghost elements of each type to receive
   void process_received_data(
-      vector<vector<vector<int> > > &recv_info,
-      vector<vector<int> > &elem_renumbering,
+      const Pane_lists &recv_info, vector<vector<int> > &elem_renumbering,
       vector<vector<map<pair<int, int>, int> > > &nodes_to_recv);
 
   // Take the data we've collected and turn it into the pconn
@@ -113,25 +138,28 @@ class Pane_ghost_connectivity {
                       vector<vector<map<pair<int, int>, int> > > &nodes_to_recv,
                       vector<vector<deque<int> > > &elems_to_send,
                       vector<vector<int> > &elem_renumbering,
-                      vector<vector<vector<int> > > &recv_info);
+                      const Pane_lists &recv_info);
 
   // Determine communicating panes for shared nodes.
   void get_cpanes();
 
-  // send_gelem_lists
-  void send_gelem_lists(vector<vector<vector<int> > > &gelem_lists,
-                        vector<vector<vector<int> > > &recv_info,
-                        vector<vector<int> > &comm_sizes);
+  // Index of the j-th communicating pane of the i-th local pane in the
+  // Pane_lists exchanged by send_pane_info.
+  int cpane_index(int i, int j) const { return _cpane_offsets[i] + j; }
 
-  // Send arbitrary amount of data to another pane.
-  // send_info = data to send
-  // recv_info = buffer for receiving data
-  // comm_sizes = amount of data to receive
-  void send_pane_info(vector<vector<vector<int> > > &send_info,
-                      vector<vector<vector<int> > > &recv_info,
-                      vector<vector<int> > &comm_sizes);
+  // Send a list to each communicating pane and receive one from it, with
+  // one message per adjacent process. If recv_info.offsets is given, the
+  // sizes of the incoming lists are known; otherwise they are exchanged
+  // first.
+  void send_pane_info(const Pane_lists &send_info, Pane_lists &recv_info);
 
  private:
+  // Build the ghost layers of the panes marked in _rebuild.
+  void build_ghosts();
+
+  // Determine which panes are to be rebuilt given the changed ones.
+  void mark_rebuilt_panes(const std::vector<int> &changed);
+
   void determine_shared_border();
 
   void mark_elems_from_nodes(std::vector<std::vector<bool> > &marked_nodes,
@@ -147,6 +175,25 @@ class Pane_ghost_connectivity {
   // List of communicating panes.
   std::vector<std::vector<int> > _cpanes;
 
+  // Index of the first communicating pane of each local pane, followed by
+  // the total number of (local pane, communicating pane) pairs.
+  std::vector<int> _cpane_offsets;
+
+  // For a pair whose communicating pane is local, the index of the
+  // reverse pair; -1 otherwise.
+  std::vector<int> _peer_pairs;
+
+  // Other processes owning communicating panes, with the pairs exchanged
+  // with each of them in the order they are packed and unpacked.
+  std::vector<int> _nbr_ranks;
+  std::vector<std::vector<int> > _nbr_send_pairs;
+  std::vector<std::vector<int> > _nbr_recv_pairs;
+
+  // Whether the ghost layer of each local pane, and of the communicating
+  // pane of each pair, is to be rebuilt.
+  std::vector<bool> _rebuild;
+  std::vector<bool> _cpane_rebuild;
+
   COM::Window *_buf_window;
 
   // Maps element type to element type string
@@ -154,7 +201,7 @@ class Pane_ghost_connectivity {
 
   // data structures for total node ordering
   vector<vector<int> > _p_gorder;
-  DataItem *_w_n_gorder;
+  vector<vector<int> > _n_gorder;
 
   // mapping from total ordering to local node id
   vector<map<pair<int, int>, int> > _local_nodes;
@@ -167,3 +214,5 @@ class Pane_ghost_connectivity {
 };
 
 MAP_END_NAMESPACE
+
+#endif /* _PANE_GHOST_CONNECTIVITY_H_ */
@@ -0,0 +1,226 @@
+//
+//  Copyright@2013, Illinois Rocstar LLC. All rights reserved.
+//
+//  See LICENSE file included with this source or
+//  (opensource.org/licenses/NCSA) for license information.
+//
+
+/** \file Element_kernel_2.h. Compile-time specialized kernels for
+ *     linear/quadratic triangle/quadrilateral elements.
+ */
+
+#ifndef _ELEMENT_KERNEL_2_H_
+#define _ELEMENT_KERNEL_2_H_
+
+#include <cmath>
+#include "Generic_element_2.h"
+
+SURF_BEGIN_NAMESPACE
+
+/** Gaussian quadrature rules for the master elements with NE edges.
+ *  DEG is the degree of accuracy, which is 1, 2 or 4 for triangles
+ *  and 1 or 2 for quadrilaterals. The tables are the same as those
+ *  used by Generic_element_2, and are defined in Generic_element_2.C.
+ */
+template <int NE, int DEG>
+struct Element_quadrature_2;
+
+template <>
+struct Element_quadrature_2<3, 1> {
+  enum { NUM_GP = 1 };
+  static constexpr double coors[NUM_GP][2] = {
+      {0.333333333333333, 0.333333333333333}};
+  static constexpr double weights[NUM_GP] = {1. / 2.};
+};
+
+template <>
+struct Element_quadrature_2<3, 2> {
+  enum { NUM_GP = 3 };
+  static constexpr double coors[NUM_GP][2] = {
+      {0.666666666666667, 0.166666666666667},
+      {0.166666666666667, 0.666666666666667},
+      {0.166666666666667, 0.166666666666667}};
+  static constexpr double weights[NUM_GP] = {1. / 6., 1. / 6., 1. / 6.};
+};
+
+template <>
+struct Element_quadrature_2<3, 4> {
+  enum { NUM_GP = 6 };
+  static constexpr double coors[NUM_GP][2] = {
+      {0.816847572980459, 0.091576213509771},
+      {0.091576213509771, 0.816847572980459},
+      {0.091576213509771, 0.091576213509771},
+      {0.108103018168070, 0.445948490915965},
+      {0.445948490915965, 0.108103018168070},
+      {0.445948490915965, 0.445948490915965}};
+  static constexpr double weights[NUM_GP] = {
+      0.054975871827661,  0.054975871827661,  0.054975871827661,
+      0.1116907948390055, 0.1116907948390055, 0.1116907948390055};
+};
+
+template <>
+struct Element_quadrature_2<4, 1> {
+  enum { NUM_GP = 4 };
+  static constexpr double coors[NUM_GP][2] = {
+      {0.2113248654051871, 0.2113248654051871},
+      {0.2113248654051871, 0.7886751345948129},
+      {0.7886751345948129, 0.2113248654051871},
+      {0.7886751345948129, 0.7886751345948129}};
+  static constexpr double weights[NUM_GP] = {1. / 4., 1. / 4., 1. / 4.,
+                                             1. / 4.};
+};
+
+template <>
+struct Element_quadrature_2<4, 2> {
+  enum { NUM_GP = 9 };
+  static constexpr double coors[NUM_GP][2] = {
+      {0.112701665379258, 0.112701665379258},
+      {0.887298334620742, 0.112701665379258},
+      {0.887298334620742, 0.887298334620742},
+      {0.112701665379258, 0.887298334620742},
+      {0.5, 0.112701665379258},
+      {0.887298334620742, 0.5},
+      {0.5, 0.887298334620742},
+      {0.112701665379258, 0.5},
+      {0.5, 0.5}};
+  static constexpr double weights[NUM_GP] = {
+      25. / 324., 25. / 324., 25. / 324., 25. / 324., 10. / 81.,
+      10. / 81.,  10. / 81.,  10. / 81.,  16. / 81.};
+};
+
+/** Element kernel specialized at compile time for an element with NN
+ *  nodes (3, 4, 6 or 8) and a quadrature rule with degree of accuracy
+ *  DOA, following the same conventions as Generic_element_2. The
+ *  values and derivatives of the shape functions at the Gauss points
+ *  are computed once in the constructor, so an object should be created
+ *  once per pane or connectivity table and reused for its elements.
+ *  The loops over the nodes have compile-time bounds and are unrolled
+ *  by the compiler.
+ */
+template <int NN, int DOA = 0>
+class Element_kernel_2 {
+ public:
+  typedef Generic_element_2::Real Real;
+  typedef Generic_element_2::Vector_2 Vector_2;
+  typedef Generic_element_2::Vector_3 Vector_3;
+  typedef Generic_element_2::Nat_coor Nat_coor;
+
+  enum {
+    NUM_NODES = NN,
+    NUM_EDGES = (NN == 3 || NN == 6) ? 3 : 4,
+    ORDER = (NN > 4) ? 2 : 1,
+    // Degree of accuracy of the quadrature rule, as in Generic_element_2
+    DEG = (DOA > ORDER ? DOA : ORDER) == 1 ? 1
+          : (NUM_EDGES == 4 || (DOA > ORDER ? DOA : ORDER) == 2) ? 2
+                                                                 : 4,
+    // Whether the Jacobian is constant within the element
+    AFFINE = (NN == 3)
+  };
+
+  typedef Element_quadrature_2<NUM_EDGES, DEG> Quadrature;
+  enum { NUM_GP = Quadrature::NUM_GP };
+
+ public:
+  Element_kernel_2() {
+    Generic_element_2 e(NUM_EDGES, NN);
+    for (int i = 0; i < NUM_GP; ++i) {
+      _ncs[i] = Nat_coor(Quadrature::coors[i][0], Quadrature::coors[i][1]);
+      e.shape_func(_ncs[i], _N[i]);
+      e.shape_func_deriv(_ncs[i], _Np[i]);
+    }
+  }
+
+  /// Number of Gauss points.
+  static int get_num_gp() { return NUM_GP; }
+
+  /// Weight associated with the ith Gauss point.
+  static Real get_gp_weight(int i) { return Quadrature::weights[i]; }
+
+  /// Natural coordinates of the ith Gauss point.
+  const Nat_coor &get_gp_nat_coor(int i) const { return _ncs[i]; }
+
+  /// Values of the shape functions at the ith Gauss point.
+  const Real *shape_func(int i) const { return _N[i]; }
+
+  /// Interpolates the field data at the ith Gauss point.
+  template <class Field, class Value>
+  void interpolate(const Field &f, int i, Value *v) const {
+    *v = f[0];
+    for (int k = 1; k < NN; ++k) *v += (f[k] - f[0]) * _N[i][k];
+  }
+
+  /// Evaluates the Jacobian at the ith Gauss point.
+  template <class Field>
+  void Jacobian(const Field &f, int i, Vector_3 J[2]) const {
+    if (AFFINE) {
+      J[0] = f[1] - f[0];
+      J[1] = f[2] - f[0];
+      return;
+    }
+
+    J[0] = J[1] = Vector_3(0, 0, 0);
+    for (int k = 1; k < NN; ++k) {
+      const Vector_3 d = f[k] - f[0];
+      J[0] += d * _Np[i][k][0];
+      J[1] += d * _Np[i][k][1];
+    }
+  }
+
+  /// Evaluates the determinant of the Jacobian at the ith Gauss point.
+  template <class Field>
+  Real Jacobian_det(const Field &f, int i) const {
+    Vector_3 J[2];
+    Jacobian(f, i, J);
+    return std::sqrt(Vector_3::cross_product(J[0], J[1]).squared_norm());
+  }
+
+  /// Integrates the determinant of the Jacobian, i.e., the area of
+  /// the element.
+  template <class Field>
+  Real area(const Field &f) const {
+    if (AFFINE) return Jacobian_det(f, 0) * 0.5;
+
+    Real a = 0;
+    for (int i = 0; i < NUM_GP; ++i)
+      a += Quadrature::weights[i] * Jacobian_det(f, i);
+    return a;
+  }
+
+ private:
+  Nat_coor _ncs[NUM_GP];
+  Real _N[NUM_GP][NN];
+  Vector_2 _Np[NUM_GP][NN];
+};
+
+typedef Element_kernel_2<3> Element_tri3;
+typedef Element_kernel_2<6> Element_tri6;
+typedef Element_kernel_2<4> Element_quad4;
+typedef Element_kernel_2<8> Element_quad8;
+
+/** Invokes op.template apply<NN>() for the number of nodes per element
+ *  nn, so that the element kernels are selected once per pane or
+ *  connectivity table instead of once per element or Gauss point.
+ */
+template <class Op>
+void dispatch_element_kernel(int nn, Op &op) {
+  switch (nn) {
+    case 3:
+      op.template apply<3>();
+      return;
+    case 4:
+      op.template apply<4>();
+      return;
+    case 6:
+      op.template apply<6>();
+      return;
+    case 8:
+      op.template apply<8>();
+      return;
+    default:
+      abort();  // Should never reach here
+  }
+}
+
+SURF_END_NAMESPACE
+
+#endif /*_ELEMENT_KERNEL_2_H_ */
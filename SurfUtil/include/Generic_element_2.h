@@ -265,8 +265,8 @@ void Generic_element_2::interpolate(const Field &f, const Nat_coor &nc,
       //     2.*xi*eta*eta_minus*( (f[1]-f[5])+(f[2]-f[5])) -
       //     2.*xi_minus*eta*eta_minus*( (f[0]-f[7])+(f[3]-f[7]));
 
-      *v += ((f[1] - f[0]) *= eta * (2. * eta - 1.)) +=
-          ((f[3] - f[0]) *= eta) += ((f[2] - f[3]) *= xi * eta) -=
+      *v += ((f[1] - f[0]) *= xi * eta_minus) += ((f[3] - f[0]) *= eta) +=
+          ((f[2] - f[3]) *= xi * eta) -=
           ((((f[0] - f[4]) += (f[1] - f[4])) *=
             2. * xi * xi_minus * eta_minus) +=
            (((f[2] - f[6]) += (f[3] - f[6])) *= 2. * xi * xi_minus * eta) +=
@@ -315,7 +315,7 @@ void Generic_element_2::interpolate_nopt(const Field &f, const Nat_coor &nc,
       const Real eta_minus = 1. - eta;
 
       *v +=
-          ((f[1] - f[0]) * eta * (2. * eta - 1.)) + ((f[3] - f[0]) * eta) +
+          ((f[1] - f[0]) * xi * eta_minus) + ((f[3] - f[0]) * eta) +
           ((f[2] - f[3]) * xi * eta) -
           ((((f[0] - f[4]) + (f[1] - f[4])) * 2. * xi * xi_minus * eta_minus) +
            (((f[2] - f[6]) + (f[3] - f[6])) * 2. * xi * xi_minus * eta) +
@@ -442,13 +442,13 @@ void Generic_element_2::Jacobian(const Field &f, const Nat_coor &nc,
       //  J[1] = xi_minus * ( f[3] - f[0]) + xi * ( f[2] - f[1]) -
       //    2.*xi*(eta_minus-eta)*( (f[1]-f[5])+(f[2]-f[5]))-
       //    2.*xi_minus*(eta_minus-eta)*( (f[0]-f[7])+(f[3]-f[7])) -
-      //    2.*xi*xi_minus*( (f[2]-f[6])-(f[3]-f[6])-(f[0]-f[4])+(f[1]-f[4]));
+      //    2.*xi*xi_minus*( (f[2]-f[6])+(f[3]-f[6])-(f[0]-f[4])-(f[1]-f[4]));
       ((J[1] = f[3] - f[0]) *= xi_minus) += ((f[2] - f[1]) *= xi) -=
           ((((f[1] - f[5]) += (f[2] - f[5])) *= 2. * xi * (eta_minus - eta)) +=
            (((f[0] - f[7]) += (f[3] - f[7])) *=
             2. * xi_minus * (eta_minus - eta)) +=
-           (((f[2] - f[6]) += (f[1] - f[4]) -=
-             ((f[3] - f[6]) += (f[0] - f[4]))) *= 2. * xi * xi_minus));
+           (((f[2] - f[6]) += (f[3] - f[6]) -=
+             ((f[0] - f[4]) += (f[1] - f[4]))) *= 2. * xi * xi_minus));
       return;
     }
     default:
@@ -110,6 +110,25 @@ class Pane_manifold_2 : public Simple_manifold_2 {
     return eID.is_border() && _cnt_pn[get_border_edgeID(eID) - 1] == 0;
   }
 
+  /** Incidence of the nodes on the elements of the pane. Each node of each
+   *  element has a slot, and the slots are numbered contiguously in the
+   *  order of the elements. The slots of each node are listed in ascending
+   *  order, so that values accumulated from the slots onto the nodes are
+   *  summed in the same order as in a serial loop over the elements. */
+  struct Node_incidence {
+    /// Slots of the jth element (0-based) are elem_offsets[j] through
+    /// elem_offsets[j+1]-1.
+    std::vector<int> elem_offsets;
+    /// Slots of the vth node (0-based) are listed in node_slots from
+    /// node_offsets[v] through node_offsets[v+1]-1.
+    std::vector<int> node_offsets;
+    std::vector<int> node_slots;
+  };
+
+  /// Obtain the incidence of the nodes on the elements. It is built on the
+  /// first call, which therefore must not be made within a parallel region.
+  const Node_incidence &node_incidence() const;
+
   /// Number of primary nodes of the pane for a given mode. In ACROSS_PANE
   /// mode, the shared nodes will be counted only if they are primary copies.
   //  int size_of_nodes( Access_Mode mode) const;
@@ -191,6 +210,8 @@ class Pane_manifold_2 : public Simple_manifold_2 {
   std::vector<int> _bd_flgs;              //< Flag of opposite face
   std::vector<char> _bd_bm;               //< Bitmap of opposite edge
   std::vector<Node> _nd_prm;              //< Primary nodes in ACROSS_PANE mode.
+
+  mutable Node_incidence _nd_inc;  //< Incidence of nodes on elements.
 };
 
 /** This class implements a data structure for 2-manifold over a whole
@@ -0,0 +1,83 @@
+//
+//  Copyright@2013, Illinois Rocstar LLC. All rights reserved.
+//
+//  See LICENSE file included with this source or
+//  (opensource.org/licenses/NCSA) for license information.
+//
+
+/** \file surf_threads.h
+ *  Helpers for threading the loops of the surface kernels with OpenMP,
+ *  which is enabled by configuring with ENABLE_OPENMP. Without OpenMP,
+ *  the helpers describe a single thread, so the kernels run serially.
+ *
+ *  The loops over elements are split into contiguous chunks, one per
+ *  thread, so that each thread can walk its chunk with an
+ *  Element_node_enumerator. Accumulations from elements onto nodes are
+ *  done by gathering the contributions of the incident elements of each
+ *  node in the order of the elements (see Pane_manifold_2::
+ *  node_incidence()), so the results are bitwise identical to the serial
+ *  loops regardless of the number of threads.
+ */
+
+#ifndef __SURF_THREADS_H_
+#define __SURF_THREADS_H_
+
+#include <algorithm>
+#include "surfbasic.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define SURF_OMP_PRAGMA(x) _Pragma(#x)
+/// Issues an OpenMP directive, e.g., SURF_OMP(parallel for).
+#define SURF_OMP(x) SURF_OMP_PRAGMA(omp x)
+#else
+#define SURF_OMP(x)
+#endif
+
+SURF_BEGIN_NAMESPACE
+
+/// Minimum number of items for which a loop is threaded.
+enum { THREAD_MIN_ITEMS = 1000 };
+
+/// Maximum number of threads used by the surface kernels.
+inline int get_max_threads() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/// Number of threads in the current parallel region.
+inline int get_num_threads() {
+#ifdef _OPENMP
+  return omp_get_num_threads();
+#else
+  return 1;
+#endif
+}
+
+/// Index of the calling thread in the current parallel region.
+inline int get_thread_num() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+/** Obtain the range [first, last) of the n items assigned to the calling
+ *  thread in the current parallel region. The items are split into
+ *  contiguous chunks of nearly equal sizes.
+ */
+inline void get_thread_range(int n, int &first, int &last) {
+  const int nt = get_num_threads(), t = get_thread_num();
+  const int q = n / nt, r = n % nt;
+
+  first = t * q + std::min(t, r);
+  last = first + q + (t < r);
+}
+
+SURF_END_NAMESPACE
+
+#endif /* __SURF_THREADS_H_ */
@@ -22,6 +22,7 @@ extern "C" void SurfX_unload_module(const char *);
 #ifdef __cplusplus
 
 #include <map>
+#include <vector>
 #include "com_devel.hpp"
 #include "rfc_basic.h"
 
@@ -35,10 +36,12 @@ class Rocface : public COM_Object {
   typedef std::map<std::string, RFC_Window_transfer *> TRS_Windows;
 
   struct Control_parameters {
-    Control_parameters() : verb(0), snap(1.e-3) {}
+    Control_parameters() : verb(0), snap(1.e-3), cache(0) {}
 
     int verb;
     double snap;
+    int cache;  // Whether to cache transfer operators and replicated
+                // coordinates of static overlays
   };
 
  public:
@@ -51,6 +54,13 @@ class Rocface : public COM_Object {
   // set verbose level
   void set_verbose(int *verbose);
 
+  // Enable or disable caching of transfer operators. When enabled, the
+  // quadrature over the subfaces is computed on the first transfer and
+  // reused by later transfers on the same overlay, and the replicated
+  // coordinates are kept until mesh_moved is called. When disabled (the
+  // default), the coordinates are replicated by every transfer.
+  void set_caching(int *cache);
+
   // read Rocface control file
   void read_control_file(const char *fname);
 
@@ -61,6 +71,20 @@ class Rocface : public COM_Object {
   // Remove the overlay.
   void clear_overlay(const char *mesh1, const char *mesh2);
 
+  // Remove the cached transfer operators of an overlay, which must be
+  // called if the coordinates of either mesh have changed.
+  void clear_transfer_cache(const char *mesh1, const char *mesh2);
+
+  // Obtain the number of cached transfer operators of an overlay, and the
+  // number of operators that have been built for it, in both directions.
+  void get_transfer_cache_info(const char *mesh1, const char *mesh2,
+                               int *ncached, int *nbuilt);
+
+  // Notify that the coordinates of a window have changed. The replicated
+  // coordinates and the cached transfer operators of all the overlays
+  // involving the window are discarded.
+  void mesh_moved(const char *wname);
+
   // Write out the overlay in HDF format for read-in later.
   void write_overlay(const COM::DataItem *mesh1, const COM::DataItem *mesh2,
                      const char *prefix1 = NULL, const char *prefix2 = NULL,
@@ -84,6 +108,21 @@ class Rocface : public COM_Object {
                               const Real *alp = NULL, const int *ord = NULL,
                               Real *tol = NULL, int *iter = NULL);
 
+  /// Transfer several dataitems between the same pair of windows at once,
+  /// so that they share the communication, the integration over the
+  /// overlay and the mass matrix.
+  /// \param srcs Names of source dataitems in the form "window.dataitem",
+  ///             separated by spaces. They must all be nodal or all facial.
+  /// \param trgs Names of target dataitems, in the same order as srcs.
+  ///             They must all be nodal or all facial.
+  /// The other parameters are the same as in least_squares_transfer. The
+  /// tolerance is applied to each dataitem, and the largest relative error
+  /// is returned in tol.
+  void least_squares_transfer_batch(const char *srcs, const char *trgs,
+                                    const Real *alp = NULL,
+                                    const int *ord = NULL, Real *tol = NULL,
+                                    int *iter = NULL);
+
   void interpolate(const COM::DataItem *att1, COM::DataItem *att2);
 
   void load_transfer(const COM::DataItem *att1, COM::DataItem *att2,
@@ -117,6 +156,14 @@ class Rocface : public COM_Object {
                 const int order = 2, Real *tol = NULL, int *iter = NULL,
                 bool load = false);
 
+  /// Batched version of transfer for conservative transfers.
+  /// \see least_squares_transfer_batch
+  template <class Source_type, class Target_type>
+  void transfer_batch(const std::vector<const COM::DataItem *> &srcs,
+                      const std::vector<COM::DataItem *> &trgs,
+                      const Real alpha, const int order, Real *tol = NULL,
+                      int *iter = NULL);
+
   int validate_object() const {
     if (_cookie != RFC_COOKIE)
       return -1;
@@ -21,6 +21,7 @@
 RFC_BEGIN_NAME_SPACE
 
 class RFC_Window_transfer;
+class Transfer_operator;
 template <class _Tag>
 class RFC_Data;
 template <class _Tag>
@@ -47,14 +48,14 @@ class RFC_Pane_transfer : public RFC_Pane_base {
   const RFC_Window_transfer *window() const { return _window; }
 
   Real *pointer(int i) {
-    if (i >= 0) {
-      if (is_master())
-        return Base::pointer(i);
-      else {
-        RFC_assertion(_data_buf_id == i);
-        return &_data_buf.front();
-      }
-    } else
+    // Replicated panes hold only the replicated data, which may be
+    // either a dataitem or a (packed) buffer of the source window.
+    if (!is_master()) {
+      RFC_assertion(_data_buf_id == i && _data_buf);
+      return _data_buf;
+    } else if (i >= 0)
+      return Base::pointer(i);
+    else
       return &_buffer[-i - 1][0];
   }
   const Real *pointer(int i) const {
@@ -86,6 +87,10 @@ class RFC_Pane_transfer : public RFC_Pane_base {
   bool is_master() const { return _base->window() != NULL; }
 
  private:
+  // Value of _data_buf_id if no data has been replicated. Negative IDs
+  // other than this one refer to buffers of the source window.
+  enum { NO_DATA_BUF = -0x7fffffff };
+
   // Data member
   RFC_Window_transfer *_window;  // Point to its parent window.
 
@@ -93,11 +98,12 @@ class RFC_Pane_transfer : public RFC_Pane_base {
   std::vector<int> _emm_offset;             // Element mass matrix
   std::vector<Real> _emm_buffer;
 
+  // Replicated data and coordinates. The data are stored in the buffer of
+  // the replication plan of the window (see RFC_Window_transfer).
   int _data_buf_id;
+  Real *_data_buf;
   std::vector<Real> _coor_buf;
-  std::vector<Real> _data_buf;
 
-  std::vector<MPI_Request> _msg_requests;
   int *_to_recv;
 
   //======= Data members to reduce communication volume for data transfer
@@ -110,7 +116,6 @@ class RFC_Pane_transfer : public RFC_Pane_base {
   // These fields are used only if this pane is the master copy.
   std::map<int, std::vector<int> > _send_faces;
   std::map<int, std::vector<int> > _send_nodes;
-  std::map<int, std::vector<Real> > _send_buffers;
 };
 
 // A window is a collection of panes.
@@ -139,6 +144,19 @@ class RFC_Window_transfer : public RFC_Window_derived<RFC_Pane_transfer> {
   // If tag is NULL, reset the tags to NULL.
   void set_tags(const COM::DataItem *tag);
 
+  // ============ Cached transfer operators for this window as target ========
+  /// Find the cached operator with given parameters. Returns NULL if none.
+  Transfer_operator *find_transfer_operator(bool snodal, bool tnodal,
+                                            Real alpha, int doa) const;
+  /// Add an operator to the cache. The window takes over its ownership.
+  void add_transfer_operator(Transfer_operator *op);
+  /// Delete all the cached operators.
+  void clear_transfer_operators();
+  /// Number of cached operators.
+  int size_of_transfer_operators() const { return _operators.size(); }
+  /// Number of operators added to the cache since the window was created.
+  int size_of_built_operators() const { return _nbuilt; }
+
   // ============ Communication subroutines for source panes ==================
   /// Returns whether replication has been performed.
   bool replicated() const { return _replicated; }
@@ -158,10 +176,21 @@ class RFC_Window_transfer : public RFC_Window_derived<RFC_Pane_transfer> {
   void replicate_metadata(const RFC_Window_transfer &opp_win);
 
   /// Replicate the given data from remote processes onto local process.
-  /// Replicate coordinates only if replicate_coor is true.
+  /// Replicate coordinates only if replicate_coor is true and, if the
+  /// coordinates are cached, they have not been replicated since the mesh
+  /// last moved.
   void replicate_data(const Facial_data_const &data, bool replicate_coor);
   void replicate_data(const Nodal_data_const &data, bool replicate_coor);
 
+  /// Keep the replicated coordinates between transfers. Valid only if the
+  /// mesh does not move, or if set_mesh_moved is called whenever it does.
+  void set_coor_caching(bool b);
+
+  /// Indicate that the coordinates of the window have changed. The
+  /// replicated coordinates are refreshed by the next replication that
+  /// needs them, and the cached transfer operators are deleted.
+  void set_mesh_moved();
+
   //============= communication subroutines for target panes ==================
   void reduce_to_all(Nodal_data &, MPI_Op);
   void reduce_maxabs_to_all(Nodal_data &);
@@ -203,6 +232,32 @@ class RFC_Window_transfer : public RFC_Window_derived<RFC_Pane_transfer> {
   void init_send_buffer(int pane_id, int to_rank);
   void init_recv_buffer(int pane_id, int from_rank);
 
+  // A plan for replicating data of a given location and dimension, with
+  // persistent MPI requests on buffers that are kept between transfers.
+  // The requests consist of the receives followed by the sends.
+  struct Replic_plan {
+    Replic_plan(bool n, int d, bool c) : nodal(n), dim(d), coor(c) {}
+
+    bool nodal;  // Whether the data are nodal
+    int dim;     // Number of components of the data
+    bool coor;   // Whether the plan is for the coordinates
+
+    std::vector<RFC_Pane_transfer *> recv_panes;
+    std::vector<std::vector<Real> > recv_bufs;  // Packed received data
+    std::vector<std::vector<Real> > data_bufs;  // Data of replicated panes
+    std::vector<std::pair<int, RFC_Pane_transfer *> > send_panes;
+    std::vector<std::vector<Real> > send_bufs;  // Packed data to be sent
+    std::vector<MPI_Request> requests;
+  };
+
+  // Obtain the plan for the given location and dimension, or create it.
+  Replic_plan *replic_plan(bool nodal, int d);
+  Replic_plan *create_replic_plan(bool nodal, int d, bool coor);
+  // Replicate the data with the given ID (or coordinates) using a plan.
+  void execute_replic_plan(Replic_plan &plan, int id);
+  void replicate_data(int id, int d, bool nodal, bool replicate_coor);
+  void free_replic_plans();
+
  private:
   int _buf_dim;
   MPI_Comm _comm;
@@ -212,6 +267,12 @@ class RFC_Window_transfer : public RFC_Window_derived<RFC_Pane_transfer> {
   bool _replicated;
 
   std::set<std::pair<int, RFC_Pane_transfer *> > _panes_to_send;  //<to_rank, p>
+  std::vector<Replic_plan *> _replic_plans;      // Plans for data
+  Replic_plan *_coor_plan;                       // Plan for coordinates
+  bool _coor_caching;     // Whether to keep the replicated coordinates
+  bool _coor_replicated;  // Whether the coordinates are up to date
+  std::vector<Transfer_operator *> _operators;  // Cached transfer operators
+  int _nbuilt;  // Number of operators built for the cache
   const std::string _prefix;
   const int _IO_format;
 };
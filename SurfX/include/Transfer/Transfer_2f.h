@@ -39,6 +39,13 @@ class Transfer_n2f : public Transfer_base {
    */
   void transfer(const Nodal_data_const &sv, Facial_data &tf, const Real alpha,
                 int doa = 0, bool verb = false);
+
+  /** Transfer several data at once.
+   *  \see Transfer_base::transfer_2f
+   */
+  void transfer(const std::vector<Nodal_data_const> &svs,
+                std::vector<Facial_data> &tfs, const Real alpha, int doa = 0,
+                bool verb = false);
 };
 
 //! Specialization for transfering from faces to faces.
@@ -55,6 +62,13 @@ class Transfer_f2f : public Transfer_base {
    */
   void transfer(const Facial_data_const &sf, Facial_data &tf, const Real alpha,
                 int doa = 0, bool verb = false);
+
+  /** Transfer several data at once.
+   *  \see Transfer_base::transfer_2f
+   */
+  void transfer(const std::vector<Facial_data_const> &sfs,
+                std::vector<Facial_data> &tfs, const Real alpha, int doa = 0,
+                bool verb = false);
 };
 
 RFC_END_NAME_SPACE
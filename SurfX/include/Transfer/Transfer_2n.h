@@ -42,6 +42,13 @@ class Transfer_n2n : public Transfer_base {
   void transfer(const Nodal_data_const &sf, Nodal_data &tf, const Real alpha,
                 Real *t, int *iter, int doa, bool ver);
 
+  /** Transfer several data at once.
+   *  \see Transfer_base::transfer_2n
+   */
+  void transfer(const std::vector<Nodal_data_const> &sfs,
+                std::vector<Nodal_data> &tfs, const Real alpha, Real *tol,
+                int *iter, int doa, bool verb);
+
   /** Compute the nodal load vector
    *  \param sf    Souce data
    *  \param tf    Target data
@@ -69,6 +76,13 @@ class Transfer_f2n : public Transfer_base {
   void transfer(const Facial_data_const &sf, Nodal_data &tf, const Real alpha,
                 Real *tol, int *iter, int doa, bool verb);
 
+  /** Transfer several data at once.
+   *  \see Transfer_base::transfer_2n
+   */
+  void transfer(const std::vector<Facial_data_const> &sfs,
+                std::vector<Nodal_data> &tfs, const Real alpha, Real *tol,
+                int *iter, int doa, bool verb);
+
   /** Compute the nodal load vector
    *  \see Transfer_n2n::comp_loads
    */
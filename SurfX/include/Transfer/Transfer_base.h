@@ -23,6 +23,8 @@
 
 RFC_BEGIN_NAME_SPACE
 
+class Transfer_operator;
+
 // The base implementation for all the transfer algorithms.
 class Transfer_base {
  public:
@@ -39,11 +41,26 @@ class Transfer_base {
       Pane_const_iterator;
 
   Transfer_base(RFC_Window_transfer *s, RFC_Window_transfer *t)
-      : src(*s), trg(*t), sc(s->color()), _src_pane(NULL), _trg_pane(NULL) {
+      : src(*s),
+        trg(*t),
+        sc(s->color()),
+        _caching(false),
+        _src_pane(NULL),
+        _trg_pane(NULL) {
     src.panes(src_ps);
     trg.panes(trg_ps);
   }
 
+  /** Use the transfer operator cached in the target window, which is
+   *  built on first use, and keep the replicated source coordinates.
+   *  Valid only if the overlay and the coordinates of both windows are
+   *  unchanged since the operator was built.
+   */
+  void set_caching(bool b) {
+    _caching = b;
+    src.set_coor_caching(b);
+  }
+
  public:
   /** template function for transfering from nodes/faces to faces.
    *  \param sDF   Souce data
@@ -71,6 +88,24 @@ class Transfer_base {
   void transfer_2n(const _SDF &sDF, Nodal_data &tDF, const Real alpha,
                    Real *tol, int *iter, int doa, bool verb);
 
+  /** Batched versions of transfer_2f and transfer_2n for several pairs of
+   *  source and target data of the same windows. The source data are
+   *  packed into one buffer, so that they are replicated in one message
+   *  per pane and integrated in one pass over the subfaces. For nodal
+   *  targets, the mass matrix is shared by a block right-hand side, and
+   *  each pair of data converges separately in PCG.
+   *  \see transfer_2f, transfer_2n
+   */
+  template <class _SDF>
+  void transfer_2f(const std::vector<_SDF> &sDFs,
+                   std::vector<Facial_data> &tDFs, const Real alpha, int doa,
+                   bool verb);
+
+  template <class _SDF>
+  void transfer_2n(const std::vector<_SDF> &sDFs,
+                   std::vector<Nodal_data> &tDFs, const Real alpha, Real *tol,
+                   int *iter, int doa, bool verb);
+
   /** Perform finite-element interpolation (non-conservative), assuming
    *  source data has been replicated.
    *  \param sDF   Souce data
@@ -97,6 +132,46 @@ class Transfer_base {
                          const Real alpha, Facial_data &tDF, Facial_data &tBF,
                          int doa);
 
+  /** Replicate the source data, integrate it over the target window and
+   *  divide by the areas. Buffers of the target window must have been
+   *  allocated, and tBF is the buffer for the areas.
+   */
+  template <class _SDF>
+  void solve_2f(const _SDF &sDF, Facial_data &tDF, Facial_data &tBF,
+                const Real alpha, int doa);
+
+  /** Replicate the source data, compute the load vector and solve the
+   *  mass matrix. Buffers 0-2 (or 0-6 if *iter>0) of the target window
+   *  must have been allocated. blks contains the offsets of the blocks
+   *  of components that are solved independently of each other.
+   */
+  template <class _SDF>
+  void solve_2n(const _SDF &sDF, Nodal_data &tDF, const Real alpha,
+                Real *tol, int *iter, int doa, const std::vector<int> &blks);
+
+  /** Allocate a buffer of dimension d in the source window, in which
+   *  the source data of a batched transfer are packed, and return its ID.
+   */
+  int init_source_buffer(Tag_nodal, int d) {
+    src.init_nodal_buffers(Nodal_data(0, d), 1, false);
+    return src.nodal_buffer(0).id();
+  }
+  int init_source_buffer(Tag_facial, int d) {
+    src.init_facial_buffers(Facial_data(0, d), 1);
+    return src.facial_buffer(0).id();
+  }
+
+  /** Copy the data with the given IDs into the packed buffer pid of the
+   *  local panes of win, or copy back from the buffer if unpack is true.
+   *  The components of the ith data occupy entries offs[i] to offs[i+1]-1
+   *  of each node (or face) in the buffer.  Data whose stride differs
+   *  from their number of components (staggered or padded arrays) are
+   *  copied entry by entry.
+   */
+  static void pack_data(RFC_Window_transfer &win, const std::vector<int> &ids,
+                        const std::vector<int> &offs, int pid, bool nodal,
+                        bool unpack);
+
   // The following are helpers for transfer_to_nodes, where
   // the geometry to be used is (1-alpha)*Source+alpha*Target.
 
@@ -114,11 +189,48 @@ class Transfer_base {
   void init_load_vector(const _SDF &vS, const Real alpha, Nodal_data &ld,
                         Nodal_data &diag, int doa, bool lump);
 
+  /** Obtain the cached transfer operator for the given source data and
+   *  the type of target data. Returns NULL if caching is disabled or if
+   *  the operator has not been built.
+   */
+  template <class _SDF, class _Tag>
+  const Transfer_operator *find_operator(const _SDF &sDF, _Tag tag,
+                                         const Real alpha, int doa) const {
+    if (!_caching) return NULL;
+    return trg.find_transfer_operator(is_nodal(sDF.tag()), is_nodal(tag),
+                                      alpha, doa);
+  }
+
+  /** Obtain the cached transfer operator, and build it if it does not
+   *  exist. Returns NULL if caching is disabled. The source data (and
+   *  the source coordinates if alpha!=1) must have been replicated.
+   */
+  template <class _SDF, class _Tag>
+  const Transfer_operator *get_operator(const _SDF &sDF, _Tag tag,
+                                        const Real alpha, int doa) {
+    if (!_caching) return NULL;
+    const Transfer_operator *op = find_operator(sDF, tag, alpha, doa);
+    if (op == NULL) {
+      Transfer_operator *p = build_operator(sDF, tag, alpha, doa);
+      trg.add_transfer_operator(p);
+      op = p;
+    }
+    return op;
+  }
+
+  /// Build the transfer operator by integrating over all the subfaces
+  /// of the target window.
+  template <class _SDF, class _Tag>
+  Transfer_operator *build_operator(const _SDF &sDF, _Tag tag,
+                                    const Real alpha, int doa);
+
   // This is a matrix-free solver that solves the equation M*x=ld,
   // where M is the mass matrix computed on the fly.
+  // The components in each block of blks are solved as separate systems
+  // sharing the mass matrix. On return, tol is the largest relative error.
   int pcg(Nodal_data &x, Nodal_data &b, Nodal_data &p, Nodal_data &q,
           Nodal_data &r, Nodal_data &s, Nodal_data &z, Nodal_data &di,
-          Real *tol, int *max_iter);
+          const std::vector<int> &blks, Real *tol, int *max_iter);
 
   /// Diagonal (Jacobi) preconditioner
   /// \param rhs is the right-hand side of the system
@@ -139,6 +251,16 @@ class Transfer_base {
             const Nodal_data_const &x2, const Nodal_data_const &y2,
             Array_n prod) const;
 
+  // Blocked versions of norm2, dot2 and saxpy, which operate on each block
+  // of components of blks separately.
+  void norm2(const Nodal_data_const &x, const std::vector<int> &blks,
+             Real *nrms) const;
+  void dot2(const Nodal_data_const &x1, const Nodal_data_const &y1,
+            const Nodal_data_const &x2, const Nodal_data_const &y2,
+            const std::vector<int> &blks, Real *prods) const;
+  void saxpy(const Real *a, const Nodal_data_const &x, const Real *b,
+             Nodal_data &y, const std::vector<int> &blks);
+
   void scale(const Real &a, Nodal_data &x);
   void invert(Nodal_data &x);
 
@@ -245,6 +367,7 @@ class Transfer_base {
   RFC_Window_transfer &src;
   RFC_Window_transfer &trg;
   int sc;
+  bool _caching;  // Whether to use cached transfer operators
 
  private:
   // Caches for the pane
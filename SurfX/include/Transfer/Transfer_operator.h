@@ -0,0 +1,112 @@
+//
+//  Copyright@2013, Illinois Rocstar LLC. All rights reserved.
+//
+//  See LICENSE file included with this source or
+//  (opensource.org/licenses/NCSA) for license information.
+//
+
+//===================================================================
+// This file contains the prototype of Transfer_operator, a precomputed
+// sparse source-to-target operator for a fixed overlay.
+//===================================================================
+
+#ifndef __TRANSFER_OPERATOR_H_
+#define __TRANSFER_OPERATOR_H_
+
+#include "RFC_Window_transfer.h"
+#include "rfc_basic.h"
+
+RFC_BEGIN_NAME_SPACE
+
+/** Caches the quadrature of the overlay for a given pair of windows.
+ *  For each subface of the target window, it stores a block of the
+ *  load-vector operator (the integral of target shape functions times
+ *  source shape functions, of size nt*ns) followed by the element mass
+ *  matrix of the subface (nt*nt). Since these depend only on the
+ *  geometry, a transfer of any field on the same overlay reduces to a
+ *  sparse matrix-vector product followed by the mass solve.
+ *
+ *  Blocks are built for all subfaces regardless of the receiving tags,
+ *  so that the operator remains valid when the tags change.
+ */
+class Transfer_operator {
+ public:
+  /** Constructor.
+   *  \param np       Number of panes of the target window
+   *  \param snodal   Whether the source data is nodal
+   *  \param tnodal   Whether the target data is nodal
+   *  \param alpha    Coordinate interpolation parameter
+   *  \param doa      Degree of accuracy of the quadrature rule
+   */
+  Transfer_operator(int np, bool snodal, bool tnodal, Real alpha, int doa)
+      : _panes(np),
+        _snodal(snodal),
+        _tnodal(tnodal),
+        _alpha(alpha),
+        _doa(doa) {}
+
+  /// Whether the operator was built with the given parameters.
+  bool match(bool snodal, bool tnodal, Real alpha, int doa) const {
+    return _snodal == snodal && _tnodal == tnodal && _alpha == alpha &&
+           _doa == doa;
+  }
+
+  /** Append a block for a subface and return the address of its weights,
+   *  which are initialized to zero. The first nt*ns entries are the
+   *  load-vector operator and the next nt*nt entries are the mass matrix.
+   *  \param k     Index of the target pane
+   *  \param p_src Source pane
+   *  \param face  Target face (the host element of the subface)
+   *  \param tids  Target node IDs (or the face ID for facial data)
+   *  \param nt    Number of target entries
+   *  \param sids  Source node IDs (or the face ID for facial data)
+   *  \param ns    Number of source entries
+   */
+  Real *new_block(int k, const RFC_Pane_transfer *p_src, int face,
+                  const int *tids, int nt, const int *sids, int ns);
+
+  /** Compute the load vector (and optionally the mass matrix) on the
+   *  target panes. The load vector must have been initialized.
+   *  \param trg_ps Target panes, in the same order as when built
+   *  \param sid    ID of the source data
+   *  \param tid    ID of the load vector
+   *  \param d      Dimension of the data
+   *  \param did    ID of the diagonal of the mass matrix (or area)
+   *  \param dd     Dimension of the diagonal (only its first entry is used)
+   *  \param mass   Whether to compute the diagonal of the mass matrix
+   *  \param lump   Whether to lump the mass matrix
+   *  \param emm    Whether to add to the element mass matrices
+   */
+  void apply(const std::vector<RFC_Pane_transfer *> &trg_ps, int sid, int tid,
+             int d, int did, int dd, bool mass, bool lump, bool emm) const;
+
+  /// Number of cached blocks.
+  int size_of_blocks() const;
+
+  /// Memory used by the operator in bytes.
+  std::size_t size_of_bytes() const;
+
+ private:
+  // Blocks of one target pane, stored contiguously.
+  struct Pane_operator {
+    Pane_operator() : offsets(1, 0), woffsets(1, 0) {}
+
+    std::vector<int> faces;  // Target face of each block
+    std::vector<const RFC_Pane_transfer *> srcs;  // Source pane
+    std::vector<int> nts, nss;       // Number of target/source entries
+    std::vector<int> offsets;        // Offsets into ids
+    std::vector<int> woffsets;       // Offsets into weights
+    std::vector<int> ids;            // nt target IDs followed by ns source IDs
+    std::vector<Real> weights;       // nt*ns operator followed by nt*nt mass
+  };
+
+  std::vector<Pane_operator> _panes;
+  const bool _snodal;
+  const bool _tnodal;
+  const Real _alpha;
+  const int _doa;
+};
+
+RFC_END_NAME_SPACE
+
+#endif  // __TRANSFER_OPERATOR_H_